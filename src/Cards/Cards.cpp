@@ -1,6 +1,7 @@
 #include "Cards.h"
+#include "Utils/Random.h"
 #include <algorithm>
-#include <chrono>
+#include <cstdint>
 #include <iostream>
 #include <random>
 
@@ -270,13 +271,15 @@ std::ostream &operator<<(std::ostream &os, const Hand &hand) {
 }
 
 //---------------------------Deck-------------------------------
-Deck::Deck()
-    : rng(std::chrono::system_clock::now().time_since_epoch().count()) {
+Deck::Deck() : rng(std::random_device{}()) {
     initialize();
 }
 
-Deck::Deck(const Deck &other)
-    : rng(std::chrono::system_clock::now().time_since_epoch().count()) {
+Deck::Deck(uint32_t seed) : rng(seed) {
+    initialize();
+}
+
+Deck::Deck(const Deck &other) : rng(other.rng) {
     // Deep copy of cards
     for (Card* card : other.cards) {
         cards.push_back(new Card(card->getCardType()));
@@ -295,6 +298,7 @@ Deck &Deck::operator=(const Deck &other) {
         for (Card* card : other.cards) {
             cards.push_back(new Card(card->getCardType()));
         }
+        rng = other.rng;
     }
     return *this;
 }
@@ -325,7 +329,7 @@ void Deck::initialize() {
     }
 
     // Shuffle the deck
-    std::shuffle(cards.begin(), cards.end(), rng);
+    randomShuffle(cards, rng);
 }
 
 Card* Deck::draw() {
@@ -343,7 +347,7 @@ void Deck::returnCard(Card* card) {
     if (card) {
         cards.push_back(card);
         // Shuffle the deck after returning a card
-        std::shuffle(cards.begin(), cards.end(), rng);
+        randomShuffle(cards, rng);
     }
 }
 
@@ -2,6 +2,7 @@
 #include "GameTypes/GameTypes.h"
 #include "Orders/Orders.h"
 #include "Player/Player.h"
+#include <cstdint>
 #include <memory>
 #include <random>
 #include <string>
@@ -56,10 +57,12 @@ class Hand {
 class Deck {
   private:
     std::vector<Card*> cards;
-    std::default_random_engine rng; // Random number generator
+    std::mt19937 rng; // Random number generator
 
   public:
-    Deck();
+    Deck(); // Shuffled from the system's entropy source
+    // Shuffles repeat exactly for the same seed (see GameContext::nextSeed)
+    explicit Deck(uint32_t seed);
     Deck(const Deck &other);
     Deck &operator=(const Deck &other);
     ~Deck();
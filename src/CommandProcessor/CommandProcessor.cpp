@@ -1,4 +1,5 @@
 #include "CommandProcessor.h"
+#include "Utils/Log.h"
 #include "Utils/Utils.h"
 #include <algorithm>
 #include <filesystem>
@@ -159,8 +160,11 @@ bool CommandProcessor::validate(Command* command, StateType state, bool print) {
         }
     }
 
-    // 2- Check if command has valid number of arguments
-    bool isValidArgs = (actualArgsCount == expectedArgsCount);
+    // 2- Check if command has valid number of arguments (a tournament may
+    // add "-S seed")
+    bool isValidArgs = (actualArgsCount == expectedArgsCount)
+        || (command->getCommandType() == CommandType::tournament
+            && actualArgsCount == expectedArgsCount + 2);
 
     // 3- Check if command is valid in current game state
     bool isValidInState = validCommands[state].end()
@@ -170,25 +174,25 @@ bool CommandProcessor::validate(Command* command, StateType state, bool print) {
     bool isValidOverall = isValidSyntax && isValidArgs && isValidInState;
 
     if (print) {
-        std::cout << "Validating command '" << command->getCommandText()
+        LOG_DEBUG << "Validating command '" << command->getCommandText()
                   << "' in state '" << stateTypeToString(state) << "'\n"
                   << std::endl;
 
-        std::cout << "Command assumed effect: " << command->getEffectText()
+        LOG_DEBUG << "Command assumed effect: " << command->getEffectText()
                   << std::endl;
 
-        std::cout << "\n1- Valid syntax: " << (isValidSyntax ? "true" : "false")
+        LOG_DEBUG << "\n1- Valid syntax: " << (isValidSyntax ? "true" : "false")
                   << std::endl;
 
-        std::cout << "2- Valid arguments: " << (isValidArgs ? "true" : "false")
+        LOG_DEBUG << "2- Valid arguments: " << (isValidArgs ? "true" : "false")
                   << std::endl;
 
-        std::cout << "3- Valid in current state: "
+        LOG_DEBUG << "3- Valid in current state: "
                   << (isValidInState ? "true" : "false") << "\n"
                   << std::endl;
 
         if (command->getCommandType() == CommandType::tournament) {
-            std::cout << "Passed initial validation: "
+            LOG_DEBUG << "Passed initial validation: "
                       << (isValidOverall ? "true" : "false") << std::endl
                       << std::endl;
 
@@ -198,7 +202,7 @@ bool CommandProcessor::validate(Command* command, StateType state, bool print) {
             }
         }
 
-        std::cout << "Will command take effect? "
+        LOG_DEBUG << "Will command take effect? "
                   << (isValidOverall ? "true" : "false") << "\n"
                   << std::endl;
     } else {
@@ -212,6 +216,23 @@ bool CommandProcessor::validate(Command* command, StateType state, bool print) {
     return isValidOverall;
 }
 
+namespace {
+// Seeds are decimal and fill 64 bits; stoull alone would accept "-1"
+bool parseSeed(std::string text, uint64_t &seed) {
+    text.erase(0, text.find_first_not_of(" \t"));
+    text.erase(text.find_last_not_of(" \t") + 1);
+    if (text.empty()
+        || text.find_first_not_of("0123456789") != std::string::npos)
+        return false;
+    try {
+        seed = std::stoull(text);
+    } catch (...) {
+        return false; // Out of range
+    }
+    return true;
+}
+} // namespace
+
 bool CommandProcessor::validateTournament(Command* command, bool print) {
 
     std::string cmdText = command->getCommandText();
@@ -221,24 +242,25 @@ bool CommandProcessor::validateTournament(Command* command, bool print) {
     size_t pPos = cmdText.find("-P");
     size_t gPos = cmdText.find("-G");
     size_t dPos = cmdText.find("-D");
+    size_t sPos = cmdText.find(" -S"); // Optional seed after -D
 
     if (mPos == std::string::npos || pPos == std::string::npos
         || gPos == std::string::npos || dPos == std::string::npos) {
         if (print) {
-            std::cout
+            LOG_INFO
                 << "4- Valid format: false\n"
                    "   ERROR: Invalid tournament command format. Expected: "
                 << "tournament -M map1,map2,... -P strat1,strat2,... "
-                << "-G numgames -D maxturns" << std::endl;
+                << "-G numgames -D maxturns [-S seed]" << std::endl;
         }
         command->saveEffect("Invalid tournament command format. Expected: "
                             "tournament -M map1,map2,... -P strat1,strat2,... "
-                            "-G numgames -D maxturns");
+                            "-G numgames -D maxturns [-S seed]");
         return false;
     }
 
     if (print) {
-        std::cout << "4- Valid format: true" << std::endl;
+        LOG_DEBUG << "4- Valid format: true" << std::endl;
     }
 
     // Parse parameters temporarily for validation
@@ -260,19 +282,19 @@ bool CommandProcessor::validateTournament(Command* command, bool print) {
         numGames = std::stoi(gamesStr);
     } catch (...) {
         if (print) {
-            std::cout << "5- Able to parse number of games: false\n"
-                      << "   ERROR: Could not parse number of games"
-                      << std::endl;
+            LOG_INFO << "5- Able to parse number of games: false\n"
+                     << "   ERROR: Could not parse number of games"
+                     << std::endl;
         }
         command->saveEffect("Invalid number of games");
         return false;
     }
 
     if (print) {
-        std::cout << "5- Able to parse number of games: true" << std::endl;
+        LOG_DEBUG << "5- Able to parse number of games: true" << std::endl;
     }
 
-    std::string turnsStr = cmdText.substr(dPos + 2);
+    std::string turnsStr = cmdText.substr(dPos + 2, sPos - dPos - 2);
     turnsStr.erase(0, turnsStr.find_first_not_of(" \t"));
     turnsStr.erase(turnsStr.find_last_not_of(" \t") + 1);
     int maxTurns;
@@ -280,16 +302,16 @@ bool CommandProcessor::validateTournament(Command* command, bool print) {
         maxTurns = std::stoi(turnsStr);
     } catch (...) {
         if (print) {
-            std::cout << "6- Able to parse number of max turns: false\n"
+            LOG_INFO << "6- Able to parse number of max turns: false\n"
                          "   ERROR: Could not parse max turns"
-                      << std::endl;
+                     << std::endl;
         }
         command->saveEffect("Invalid max turns");
         return false;
     }
 
     if (print) {
-        std::cout << "6- Able to parse number of max turns: true" << std::endl;
+        LOG_DEBUG << "6- Able to parse number of max turns: true" << std::endl;
     }
 
     // Validate ranges
@@ -297,19 +319,19 @@ bool CommandProcessor::validateTournament(Command* command, bool print) {
 
     if (maps.size() < 1 || maps.size() > 5) {
         if (print) {
-            std::cout << "7- Valid number of maps: false\n"
+            LOG_INFO << "7- Valid number of maps: false\n"
                          "   ERROR: Invalid number of maps (must be 1-5, got "
-                      << maps.size() << ")" << std::endl;
+                     << maps.size() << ")" << std::endl;
         }
         command->saveEffect("Invalid number of maps (must be 1-5)");
         isValid = false;
     } else if (print) {
-        std::cout << "7- Valid number of maps: true" << std::endl;
+        LOG_DEBUG << "7- Valid number of maps: true" << std::endl;
     }
 
     if (strategies.size() < 2 || strategies.size() > 4) {
         if (print) {
-            std::cout
+            LOG_INFO
                 << "8- Valid number of strategies: false\n"
                    "   ERROR: Invalid number of strategies (must be 2-4, got "
                 << strategies.size() << ")" << std::endl;
@@ -317,31 +339,46 @@ bool CommandProcessor::validateTournament(Command* command, bool print) {
         command->saveEffect("Invalid number of strategies (must be 2-4)");
         isValid = false;
     } else if (print) {
-        std::cout << "8- Valid number of strategies: true" << std::endl;
+        LOG_DEBUG << "8- Valid number of strategies: true" << std::endl;
     }
 
     if (numGames < 1 || numGames > 5) {
         if (print) {
-            std::cout << "9- Valid number of games: false\n"
+            LOG_INFO << "9- Valid number of games: false\n"
                          "   ERROR: Invalid number of games (must be 1-5, got "
-                      << numGames << ")" << std::endl;
+                     << numGames << ")" << std::endl;
         }
         command->saveEffect("Invalid number of games (must be 1-5)");
         isValid = false;
     } else if (print) {
-        std::cout << "9- Valid number of games: true" << std::endl;
+        LOG_DEBUG << "9- Valid number of games: true" << std::endl;
     }
 
     if (maxTurns < 10 || maxTurns > 50) {
         if (print) {
-            std::cout << "10- Valid number of max turns: false\n"
+            LOG_INFO << "10- Valid number of max turns: false\n"
                          "   ERROR: Invalid max turns (must be 10-50, got "
-                      << maxTurns << ")" << std::endl;
+                     << maxTurns << ")" << std::endl;
         }
         command->saveEffect("Invalid max turns (must be 10-50)");
         isValid = false;
     } else if (print) {
-        std::cout << "10- Valid number of max turns: true\n" << std::endl;
+        LOG_DEBUG << "10- Valid number of max turns: true\n" << std::endl;
+    }
+
+    uint64_t seed;
+    if (sPos != std::string::npos
+        && !parseSeed(cmdText.substr(sPos + 3), seed)) {
+        if (print) {
+            LOG_INFO << "11- Valid seed: false\n"
+                        "   ERROR: Invalid seed (must be a non-negative "
+                        "integer)"
+                     << std::endl;
+        }
+        command->saveEffect("Invalid seed (must be a non-negative integer)");
+        isValid = false;
+    } else if (print && sPos != std::string::npos) {
+        LOG_DEBUG << "11- Valid seed: true\n" << std::endl;
     }
 
     return isValid;
@@ -356,6 +393,7 @@ Tournament CommandProcessor::prepareTournament(const std::string &cmdText) {
     size_t pPos = cmdText.find("-P");
     size_t gPos = cmdText.find("-G");
     size_t dPos = cmdText.find("-D");
+    size_t sPos = cmdText.find(" -S");
 
     // Parse maps
     std::string mapsStr = cmdText.substr(mPos + 2, pPos - mPos - 2);
@@ -376,11 +414,16 @@ Tournament CommandProcessor::prepareTournament(const std::string &cmdText) {
     tournament.numGames = std::stoi(gamesStr);
 
     // Parse max turns
-    std::string turnsStr = cmdText.substr(dPos + 2);
+    std::string turnsStr = cmdText.substr(dPos + 2, sPos - dPos - 2);
     turnsStr.erase(0, turnsStr.find_first_not_of(" \t"));
     turnsStr.erase(turnsStr.find_last_not_of(" \t") + 1);
     tournament.maxTurns = std::stoi(turnsStr);
 
+    // Parse the optional seed
+    if (sPos != std::string::npos)
+        tournament.seeded =
+            parseSeed(cmdText.substr(sPos + 3), tournament.seed);
+
     return tournament;
 }
 
@@ -423,7 +466,7 @@ Command* FileCommandProcessorAdapter::readCommand() {
             || input.find_first_not_of(" \t\n\r") == std::string::npos) {
             return readCommand();
         }
-        std::cout << "Reading command from file: '" << input << "'"
+        LOG_DEBUG << "Reading command from file: '" << input << "'"
                   << std::endl;
         Command* cmd = new Command(input);
         saveCommand(cmd);
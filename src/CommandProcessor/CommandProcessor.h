@@ -1,6 +1,7 @@
 #pragma once
 #include "GameTypes/GameTypes.h"
 #include "LoggingObserver/LoggingObserver.h"
+#include <cstdint>
 #include <fstream>
 #include <iostream>
 #include <map>
@@ -16,6 +17,8 @@ struct Tournament {
     std::vector<std::string> strategies; // Strategy names
     int numGames;
     int maxTurns;
+    bool seeded = false; // Set by -S; otherwise a random seed is drawn
+    uint64_t seed = 0;
 };
 
 // Represent a command issued by the user (file or console)
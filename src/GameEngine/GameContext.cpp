@@ -0,0 +1,78 @@
+#include "GameContext.h"
+#include "Player/Player.h"
+#include "PlayerStrategies/PlayerStrategies.h"
+#include "Utils/Random.h"
+
+namespace {
+// SplitMix64 finalizer: spreads nearby inputs over the whole 64-bit range
+uint64_t mix(uint64_t value) {
+    value += 0x9e3779b97f4a7c15ULL;
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+    return value ^ (value >> 31);
+}
+} // namespace
+
+GameContext::GameContext() : GameContext(randomSeed()) {}
+
+GameContext::GameContext(uint64_t seed)
+    : neutralPlayer(nullptr), seed(seed), rng(seed) {}
+
+GameContext::~GameContext() {
+    if (neutralPlayer)
+        delete neutralPlayer->getStrategy();
+    delete neutralPlayer;
+}
+
+void GameContext::addNegotiatedPair(Player* first, Player* second) {
+    negotiatedPairs.insert(std::make_pair(first, second));
+    negotiatedPairs.insert(std::make_pair(second, first));
+}
+
+void GameContext::clearNegotiatedPairs() {
+    negotiatedPairs.clear();
+}
+
+bool GameContext::areNegotiating(Player* attacker, Player* defender) const {
+    return negotiatedPairs.count(std::make_pair(attacker, defender)) != 0;
+}
+
+Player* GameContext::getNeutralPlayer() {
+    if (!neutralPlayer) {
+        neutralPlayer = new Player("Neutral");
+        neutralPlayer->setContext(this);
+    }
+    return neutralPlayer;
+}
+
+uint64_t GameContext::getSeed() const {
+    return seed;
+}
+
+int GameContext::nextInt(int bound) {
+    return static_cast<int>(randomBelow(rng, static_cast<uint64_t>(bound)));
+}
+
+uint32_t GameContext::nextSeed() {
+    return static_cast<uint32_t>(rng() >> 32);
+}
+
+std::mt19937_64 &GameContext::getRandomEngine() {
+    return rng;
+}
+
+uint64_t GameContext::randomSeed() {
+    std::random_device device;
+    return (uint64_t(device()) << 32) | device();
+}
+
+uint64_t GameContext::gameSeed(uint64_t masterSeed,
+                               size_t mapIdx,
+                               size_t gameIdx) {
+    return mix(mix(masterSeed ^ mix(mapIdx)) ^ gameIdx);
+}
+
+GameContext &GameContext::shared() {
+    static GameContext context;
+    return context;
+}
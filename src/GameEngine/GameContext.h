@@ -0,0 +1,64 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <set>
+#include <utility>
+
+// Forward declarations
+class Player;
+
+// Mutable state that belongs to a single game rather than to the process:
+// the negotiated (no-attack) pairs of the current turn, the neutral player
+// that blockaded territories go to, and the random source for battles and
+// card rewards. Each GameEngine owns one and hands it to its players, so
+// games running side by side never share anything they write.
+//
+// Every random choice of a game (territory and player order, the deck's
+// shuffles, battles and card rewards) is drawn from the context's engine,
+// so two games started from the same seed play out identically.
+class GameContext {
+  private:
+    std::set<std::pair<Player*, Player*>> negotiatedPairs;
+    Player* neutralPlayer;
+    uint64_t seed;
+    std::mt19937_64 rng;
+
+  public:
+    GameContext(); // Seeded with randomSeed()
+    explicit GameContext(uint64_t seed);
+    ~GameContext(); // Deletes the neutral player, if one was created
+    GameContext(const GameContext &) = delete;
+    GameContext &operator=(const GameContext &) = delete;
+
+    // Players that negotiated cannot attack each other until the pairs
+    // are cleared at the end of the turn
+    void addNegotiatedPair(Player* first, Player* second);
+    void clearNegotiatedPairs();
+    bool areNegotiating(Player* attacker, Player* defender) const;
+
+    // Created on first use and owned by the context
+    Player* getNeutralPlayer();
+
+    // The seed this game was started from; replaying it repeats the game
+    uint64_t getSeed() const;
+
+    // Uniform in [0, bound)
+    int nextInt(int bound);
+    // Seed for a component that keeps its own engine, such as the Deck
+    uint32_t nextSeed();
+    // For randomShuffle() and randomBelow() (Utils/Random.h)
+    std::mt19937_64 &getRandomEngine();
+
+    // A fresh seed from the system's entropy source
+    static uint64_t randomSeed();
+    // Seed of game gameIdx on map mapIdx of a tournament started from
+    // masterSeed. Depends on nothing else, so any single game can be
+    // replayed without playing the ones before it.
+    static uint64_t gameSeed(uint64_t masterSeed,
+                             size_t mapIdx,
+                             size_t gameIdx);
+
+    // Context for players created outside any game engine (drivers, tools)
+    static GameContext &shared();
+};
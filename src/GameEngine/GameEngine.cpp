@@ -1,6 +1,10 @@
 #include "GameEngine.h"
+#include "GameContext.h"
 #include "Map/Map.h"
+#include "Map/MapPrefetcher.h"
 #include "PlayerStrategies/PlayerStrategies.h"
+#include "Utils/Log.h"
+#include "Utils/Random.h"
 #include "Utils/Utils.h"
 #include <algorithm>
 #include <iomanip>
@@ -8,18 +12,20 @@
 using std::cin;
 
 void printInvalidCommandError() {
-    std::cout << "Invalid command." << std::endl;
+    LOG_INFO << "Invalid command." << std::endl;
 }
 
 //---------------------------State-------------------------------
-State::State(StateType stateType) : stateType(stateType) {}
+State::State(StateType stateType)
+    : stateType(stateType), currentPlayerTurn(new std::string()) {}
 State::State(const State &other)
-    : stateType(other.stateType), currentPlayerTurn(other.currentPlayerTurn) {}
+    : stateType(other.stateType),
+      currentPlayerTurn(new std::string(*other.currentPlayerTurn)) {}
 
 State &State::operator=(const State &other) {
     if (this != &other) {
         stateType = other.stateType;
-        currentPlayerTurn = other.currentPlayerTurn;
+        *currentPlayerTurn = *other.currentPlayerTurn;
     }
     return *this;
 }
@@ -53,51 +59,45 @@ std::ostream &operator<<(std::ostream &os, const State &state) {
 }
 
 //---------------------------GameEngine--------------------------
-GameEngine::GameEngine(CommandProcessor* cmdProcessor)
-    : state(new State(StateType::start)), mapLoader(nullptr),
-      currentMapPath(new std::string()), currentMap(nullptr),
-      currentPlayer(nullptr), deck(new Deck()), commandProcessor(cmdProcessor),
-      logObserver(new LogObserver()) {}
-
-GameEngine::GameEngine(const GameEngine &other)
-    : state(new State(*other.state)),
-      mapLoader(new MapLoader(*other.mapLoader)),
-      currentMapPath(new std::string(*other.currentMapPath)),
-      currentMap(new Map(*other.currentMap)),
-      currentPlayer(other.currentPlayer), deck(new Deck(*other.deck)),
-      commandProcessor(new CommandProcessor(*other.commandProcessor)),
-      logObserver(new LogObserver()), players(other.players) {}
-
-GameEngine &GameEngine::operator=(const GameEngine &other) {
-    if (this != &other) {
-        delete state;
-        delete currentMap;
-        delete deck;
-        delete logObserver;
-        state = new State(*other.state);
-        players = other.players;
-        currentPlayer = other.currentPlayer;
-        currentMap = new Map(*other.currentMap);
-        mapLoader = new MapLoader(*other.mapLoader);
-        deck = new Deck(*other.deck);
-        commandProcessor = new CommandProcessor(*other.commandProcessor);
-        logObserver = new LogObserver();
-    }
-    return *this;
-}
+GameEngine::GameEngine(CommandProcessor* cmdProcessor, LogObserver* observer)
+    : state(new State(StateType::start)), currentMapPath(new std::string()),
+      currentMap(nullptr),
+      currentPlayer(nullptr), context(new GameContext()),
+      deck(new Deck(context->nextSeed())), commandProcessor(cmdProcessor),
+      logObserver(observer ? observer : new LogObserver()),
+      profile(new TurnProfile()) {}
 
 GameEngine::~GameEngine() {
     delete state;
+    delete currentMapPath;
     delete currentMap;
     delete deck;
     delete logObserver;
-    players.clear();
+    delete context;
+    delete profile;
+    deletePlayers();
     currentPlayer = nullptr;
 }
 
+void GameEngine::deletePlayers() {
+    // Each player was given its own strategy by addPlayer() or
+    // playTournamentGame(). Cards in a hand were drawn out of the deck or
+    // awarded, so nothing else owns them.
+    players.insert(players.end(), eliminatedPlayers.begin(),
+                   eliminatedPlayers.end());
+    eliminatedPlayers.clear();
+    for (Player* player : players) {
+        for (Card* card : player->getCards())
+            delete card;
+        delete player->getStrategy();
+        delete player;
+    }
+    players.clear();
+}
+
 void GameEngine::startupPhase(bool runMainLoop) {
-    std::cout << "\nStarting Warzone Game" << std::endl;
-    std::cout << "===================" << std::endl;
+    LOG_INFO << "\nStarting Warzone Game" << std::endl;
+    LOG_INFO << "===================" << std::endl;
 
     // Attach LogObserver to GameEngine and CommandProcessor
     this->Attach(logObserver);
@@ -106,18 +106,18 @@ void GameEngine::startupPhase(bool runMainLoop) {
     bool shouldExit = false;
     while (!shouldExit) {
         StateType currentState = state->getStateType();
-        std::cout << "\nCurrent state: " << stateTypeToString(currentState)
-                  << std::endl;
-        std::cout << "Available commands:" << std::endl;
+        LOG_INFO << "\nCurrent state: " << stateTypeToString(currentState)
+                 << std::endl;
+        LOG_INFO << "Available commands:" << std::endl;
         for (const auto &cmd : validCommands[currentState]) {
-            std::cout << "  - " << commandTypeToString(cmd) << " "
-                      << getCommandArgsString(cmd) << std::endl;
+            LOG_INFO << "  - " << commandTypeToString(cmd) << " "
+                     << getCommandArgsString(cmd) << std::endl;
         }
 
         Command* cmd = commandProcessor->getCommand();
         if (cmd == nullptr) {
-            std::cout << "\nEnd of command file reached. Exiting game."
-                      << std::endl;
+            LOG_INFO << "\nEnd of command file reached. Exiting game."
+                     << std::endl;
             shouldExit = true;
             break;
         }
@@ -201,63 +201,81 @@ void GameEngine::startupPhase(bool runMainLoop) {
         }
     }
 
-    std::cout << "\nGame ended" << std::endl;
+    LOG_INFO << "\nGame ended" << std::endl;
+}
+
+std::string GameEngine::resolveMapPath(const std::string &filename) {
+    return (std::filesystem::current_path() / "res" / filename).string();
 }
 
 void GameEngine::loadMap(const std::string &filename) {
     if (state->getStateType() != StateType::start
         && state->getStateType() != StateType::maploaded) {
-        std::cout << "Cannot load map in current state" << std::endl;
+        LOG_INFO << "Cannot load map in current state" << std::endl;
         return;
     }
 
-    std::filesystem::path currentPath = std::filesystem::current_path();
-    std::filesystem::path mapPath = currentPath / "res" / filename;
+    std::string mapPath = resolveMapPath(filename);
 
     try {
-        mapLoader = new MapLoader(mapPath.string());
-        currentMap = mapLoader->loadMap();
+        // Maps are parsed, indexed and validated once per process; each
+        // load only clones the registered topology
+        currentMapEntry = MapRegistry::shared().acquire(mapPath);
+        LOG_INFO << currentMapEntry->diagnostics;
+        delete currentMap;
+        currentMap = currentMapEntry->instantiate();
         if (currentMap != nullptr) {
+            *currentMapPath = mapPath;
             state->setStateType(StateType::maploaded);
-            std::cout << "Map loaded successfully: " << filename << std::endl;
+            LOG_INFO << "Map loaded successfully: " << filename << std::endl;
             Notify(this);
         } else {
-            std::cout << "Failed to load map: " << filename << std::endl;
+            LOG_INFO << "Failed to load map: " << filename << std::endl;
         }
     } catch (const std::exception &e) {
-        std::cout << "Error loading map: " << e.what() << std::endl;
+        LOG_INFO << "Error loading map: " << e.what() << std::endl;
     }
 }
 
 void GameEngine::validateMap() {
     if (state->getStateType() != StateType::maploaded) {
-        std::cout << "Must load a map before validating" << std::endl;
+        LOG_INFO << "Must load a map before validating" << std::endl;
         return;
     }
 
-    if (currentMap != nullptr && currentMap->validate()) {
+    // The registry validated the topology when it loaded it
+    bool valid = false;
+    if (currentMap != nullptr && currentMapEntry) {
+        LOG_INFO << currentMapEntry->validation;
+        valid = currentMapEntry->isValid();
+    } else if (currentMap != nullptr) {
+        valid = currentMap->validate();
+    }
+
+    if (valid) {
         state->setStateType(StateType::mapvalidated);
-        std::cout << "Map validated successfully" << std::endl;
+        LOG_INFO << "Map validated successfully" << std::endl;
         Notify(this);
     } else {
-        std::cout << "Map validation failed" << std::endl;
+        LOG_INFO << "Map validation failed" << std::endl;
     }
 }
 
 void GameEngine::addPlayer(const std::string &playerName) {
     // Check if we already have 6 players
     if (players.size() >= 6) {
-        std::cout << "Maximum number of players (6) reached" << std::endl;
+        LOG_INFO << "Maximum number of players (6) reached" << std::endl;
         return;
     }
 
     Player* newPlayer = new Player(playerName);
+    newPlayer->setContext(context);
     players.push_back(newPlayer);
 
     // Attach LogObserver to the player's OrdersList
     newPlayer->getOrdersList()->Attach(logObserver);
 
-    std::cout << "Player added: " << playerName << std::endl;
+    LOG_INFO << "Player added: " << playerName << std::endl;
 
     // Move to playeradded state if we have at least 2 players
     if (players.size() >= 2) {
@@ -270,7 +288,7 @@ void GameEngine::distributeInitialArmies() {
     for (Player* player : players) {
         player->setReinforcementPool(50);
     }
-    std::cout << "Each player received 50 initial army units" << std::endl;
+    LOG_DEBUG << "Each player received 50 initial army units" << std::endl;
 }
 
 void GameEngine::drawInitialCards() {
@@ -284,25 +302,25 @@ void GameEngine::drawInitialCards() {
             }
         }
     }
-    std::cout << "Each player has drawn 2 initial cards" << std::endl;
+    LOG_DEBUG << "Each player has drawn 2 initial cards" << std::endl;
 }
 
 void GameEngine::gameStart(bool runMainLoop) {
     if (state->getStateType() != StateType::playeradded) {
-        std::cout << "Cannot start game in current state" << std::endl;
+        LOG_INFO << "Cannot start game in current state" << std::endl;
         return;
     }
 
     if (players.size() < 2 || players.size() > 6) {
-        std::cout << "Need between 2 and 6 players to start the game"
-                  << std::endl;
+        LOG_INFO << "Need between 2 and 6 players to start the game"
+                 << std::endl;
         return;
     }
 
     // Print all continents and their details first
-    std::cout << "\n=== Map Continents ===" << std::endl;
+    LOG_DEBUG << "\n=== Map Continents ===" << std::endl;
     for (Continent* continent : currentMap->getContinents()) {
-        std::cout << "Continent Name: " << continent->getName()
+        LOG_TRACE << "Continent Name: " << continent->getName()
                   << ", Territories: " << continent->getTerritories().size()
                   << ", Bonus: " << continent->getBonus() << std::endl;
     }
@@ -316,9 +334,8 @@ void GameEngine::gameStart(bool runMainLoop) {
     }
 
     // Shuffle territories for random distribution
-    std::random_device rd;
-    std::mt19937 g(rd());
-    std::shuffle(allTerritories.begin(), allTerritories.end(), g);
+    std::mt19937_64 &random = context->getRandomEngine();
+    randomShuffle(allTerritories, random);
 
     // Distribute territories to players
     size_t playerCount = players.size();
@@ -327,22 +344,22 @@ void GameEngine::gameStart(bool runMainLoop) {
     }
 
     // Print each player's allocated territories
-    std::cout << "\n=== Territory Distribution ===" << std::endl;
+    LOG_DEBUG << "\n=== Territory Distribution ===" << std::endl;
     for (Player* player : players) {
-        std::cout << "\nPlayer " << player->getName()
+        LOG_TRACE << "\nPlayer " << player->getName()
                   << " received:" << std::endl;
         for (Territory* territory : player->getTerritories()) {
-            std::cout << "  - " << territory->getName() << std::endl;
+            LOG_TRACE << "  - " << territory->getName() << std::endl;
         }
     }
 
-    std::cout << "\nTerritories have been fairly distributed" << std::endl;
+    LOG_DEBUG << "\nTerritories have been fairly distributed" << std::endl;
 
     // 2. Randomly determine play order
-    std::shuffle(players.begin(), players.end(), g);
-    std::cout << "\nPlayer order has been randomized. New order:" << std::endl;
+    randomShuffle(players, random);
+    LOG_DEBUG << "\nPlayer order has been randomized. New order:" << std::endl;
     for (size_t i = 0; i < players.size(); ++i) {
-        std::cout << (i + 1) << ". " << players[i]->getName() << std::endl;
+        LOG_TRACE << (i + 1) << ". " << players[i]->getName() << std::endl;
     }
 
     // 3. Give initial armies
@@ -353,13 +370,18 @@ void GameEngine::gameStart(bool runMainLoop) {
 
     // 5. Switch to play phase
     state->setStateType(StateType::assignreinforcement);
-    std::cout << "\nGame has started! Moving to reinforcement phase."
+    LOG_DEBUG << "\nGame has started! Moving to reinforcement phase."
               << std::endl;
     Notify(this);
 
     // Only call mainGameLoop if runMainLoop is true
     if (runMainLoop) {
         mainGameLoop();
+        if (Profiler::isEnabled()) {
+            std::ostringstream table;
+            profile->print(table, "this game");
+            LOG_RESULT << "\n" << table.str();
+        }
     } else {
         state->setStateType(StateType::win);
     }
@@ -367,30 +389,44 @@ void GameEngine::gameStart(bool runMainLoop) {
 
 void GameEngine::mainGameLoop(bool runExecuteOrdersPhase, int maxTurns) {
     int turnCount = 0;
+    auto gameWon = [this]() {
+        ScopedTimer timer(profile->phase(TurnPhase::CheckWin));
+        return checkWinCondition();
+    };
 
-    while (!checkWinCondition()) {
+    while (!gameWon()) {
         // Check turn limit for tournament mode
         if (maxTurns > 0 && turnCount >= maxTurns) {
-            std::cout << "\n=== Maximum turns (" << maxTurns
-                      << ") reached. Game ends in a draw. ===" << std::endl;
+            LOG_INFO << "\n=== Maximum turns (" << maxTurns
+                     << ") reached. Game ends in a draw. ===" << std::endl;
             state->setStateType(StateType::win);
             return; // Exit without announcing a winner
         }
 
         turnCount++;
-        std::cout << "\n=== Turn " << turnCount << " ===" << std::endl;
+        LOG_DEBUG << "\n=== Turn " << turnCount << " ===" << std::endl;
 
         // Remove any defeated players before starting the next round
-        removeDefeatedPlayers();
+        {
+            ScopedTimer timer(profile->phase(TurnPhase::RemoveDefeated));
+            removeDefeatedPlayers();
+        }
 
         // Check if we have a winner after removing defeated players
-        if (checkWinCondition())
+        if (gameWon())
             break;
 
         // Execute each phase in order
-        reinforcementPhase();
-        issueOrdersPhase();
+        {
+            ScopedTimer timer(profile->phase(TurnPhase::Reinforcement));
+            reinforcementPhase();
+        }
+        {
+            ScopedTimer timer(profile->phase(TurnPhase::IssueOrders));
+            issueOrdersPhase();
+        }
         if (runExecuteOrdersPhase) {
+            ScopedTimer timer(profile->phase(TurnPhase::ExecuteOrders));
             executeOrdersPhase();
         } else {
             break;
@@ -400,8 +436,8 @@ void GameEngine::mainGameLoop(bool runExecuteOrdersPhase, int maxTurns) {
     // Announce winner (only if someone actually won by conquering all)
     for (Player* player : players) {
         if (!player->getTerritories().empty()) {
-            std::cout << "Player " << player->getName() << " has won the game!"
-                      << std::endl;
+            LOG_INFO << "Player " << player->getName() << " has won the game!"
+                     << std::endl;
             break;
         }
     }
@@ -410,25 +446,25 @@ void GameEngine::mainGameLoop(bool runExecuteOrdersPhase, int maxTurns) {
 }
 
 void GameEngine::reinforcementPhase() {
-    std::cout << "\n=== Reinforcement Phase ===" << std::endl;
+    LOG_DEBUG << "\n=== Reinforcement Phase ===" << std::endl;
 
     for (Player* player : players) {
         int reinforcements = calculateReinforcement(player);
         player->setReinforcementPool(player->getReinforcementPool()
                                      + reinforcements);
 
-        std::cout << "Player " << player->getName() << " receives "
+        LOG_DEBUG << "Player " << player->getName() << " receives "
                   << reinforcements << " reinforcement armies" << std::endl;
     }
 }
 
 void GameEngine::issueOrdersPhase() {
-    std::cout << "\n=== Issue Orders Phase ===" << std::endl;
+    LOG_DEBUG << "\n=== Issue Orders Phase ===" << std::endl;
 
     // Round-robin: Each player completes ALL their order issuing before moving
     // to next player
     for (Player* player : players) {
-        std::cout << "\n--- Player " << player->getName() << "'s Turn ---"
+        LOG_TRACE << "\n--- Player " << player->getName() << "'s Turn ---"
                   << std::endl;
 
         // Reset available reinforcement pool to match actual pool
@@ -436,17 +472,22 @@ void GameEngine::issueOrdersPhase() {
 
         // Call issueOrder() which handles everything atomically
         // Player must finish all their actions before this returns
-        player->issueOrder(deck);
+        {
+            PlayerStrategy* strategy = player->getStrategy();
+            ScopedTimer timer(profile->issueOrder(
+                strategy ? strategy->getName() : player->getName()));
+            player->issueOrder(deck);
+        }
 
-        std::cout << "Player " << player->getName()
+        LOG_TRACE << "Player " << player->getName()
                   << " has finished their turn." << std::endl;
     }
 
-    std::cout << "\nAll players have finished issuing orders." << std::endl;
+    LOG_DEBUG << "\nAll players have finished issuing orders." << std::endl;
 }
 
 void GameEngine::executeOrdersPhase() {
-    std::cout << "\n=== Execute Orders Phase ===" << std::endl;
+    LOG_DEBUG << "\n=== Execute Orders Phase ===" << std::endl;
 
     // Reset conquest flags for all players at the start of execution phase
     for (Player* player : players) {
@@ -454,48 +495,41 @@ void GameEngine::executeOrdersPhase() {
     }
 
     for (Player* player : players) {
-        std::cout << "\n--- Executing orders for " << player->getName()
+        LOG_TRACE << "\n--- Executing orders for " << player->getName()
                   << " ---" << std::endl;
 
+        // Split the orders once; executing an order never issues new ones
         OrdersList* ordersList = player->getOrdersList();
+        std::list<Order*> deploys;
+        std::list<Order*> others;
+        ordersList->takeOrders(deploys, others);
 
         // Phase 1: Execute all Deploy orders for this player
-        std::cout << "1. Executing Deploy orders for " << player->getName()
+        LOG_TRACE << "1. Executing Deploy orders for " << player->getName()
                   << "..." << std::endl;
-        auto orders = ordersList->getOrders(); // Get copy of list
-        for (auto it = orders.begin(); it != orders.end();) {
-            Order* order = *it;
-            if (dynamic_cast<Deploy*>(order) != nullptr) {
-                order->Attach(logObserver);
-                order->execute();
-                ordersList->remove(order);
-                orders = ordersList->getOrders();
-                it = orders.begin();
-            } else {
-                ++it;
-            }
+        for (Order* order : deploys) {
+            order->Attach(logObserver);
+            order->execute();
+            ordersList->retire(order);
         }
 
         // Phase 2: Execute all other orders for this player
-        std::cout << "\n2. Executing other orders for " << player->getName()
+        LOG_TRACE << "\n2. Executing other orders for " << player->getName()
                   << "..." << std::endl;
-        orders = ordersList->getOrders(); // Refresh list
-        while (!orders.empty()) {
-            Order* order = orders.front();
+        for (Order* order : others) {
             order->Attach(logObserver);
             order->execute();
-            ordersList->remove(order);
-            orders = ordersList->getOrders(); // Refresh list
+            ordersList->retire(order);
         }
 
-        std::cout << "Player " << player->getName()
+        LOG_TRACE << "Player " << player->getName()
                   << " has completed all orders." << std::endl;
     }
 
     // Clear negotiated pairs at the end of the turn
-    Advance::clearNegotiatedPairs();
+    context->clearNegotiatedPairs();
 
-    std::cout << "\n=== All orders have been executed ===" << std::endl;
+    LOG_DEBUG << "\n=== All orders have been executed ===" << std::endl;
 }
 
 int GameEngine::calculateReinforcement(Player* player) {
@@ -503,40 +537,22 @@ int GameEngine::calculateReinforcement(Player* player) {
     int baseReinforcement = std::max(3, territoryCount / 3);
     int continentBonus = 0;
 
-    std::cout << "\nCalculating reinforcements for Player " << player->getName()
+    LOG_TRACE << "\nCalculating reinforcements for Player " << player->getName()
               << ":" << std::endl;
-    std::cout << "  Territory count: " << territoryCount << std::endl;
-    std::cout << "  Base reinforcement (max(3, territories/3)): "
+    LOG_TRACE << "  Territory count: " << territoryCount << std::endl;
+    LOG_TRACE << "  Base reinforcement (max(3, territories/3)): "
               << baseReinforcement << std::endl;
 
-    // Check for continent control bonuses
-    for (Continent* continent : currentMap->getContinents()) {
-        bool controlsContinent = true;
-        for (Territory* territory : continent->getTerritories()) {
-            // Check if territory is in player's territories
-            bool found = false;
-            for (Territory* playerTerritory : player->getTerritories()) {
-                if (territory == playerTerritory) {
-                    found = true;
-                    break;
-                }
-            }
-            if (!found) {
-                controlsContinent = false;
-                break;
-            }
-        }
-        if (controlsContinent) {
-            continentBonus += continent->getBonus();
-            std::cout << "  + Bonus " << continent->getBonus()
-                      << " for controlling " << continent->getName()
-                      << std::endl;
-        }
+    // Check for continent control bonuses (maintained per-continent counters)
+    for (Continent* continent : currentMap->getContinentsControlledBy(player)) {
+        continentBonus += continent->getBonus();
+        LOG_TRACE << "  + Bonus " << continent->getBonus()
+                  << " for controlling " << continent->getName() << std::endl;
     }
 
-    std::cout << "  Base reinforcement: " << baseReinforcement << std::endl;
-    std::cout << "  Total bonuses: " << continentBonus << std::endl;
-    std::cout << "  Final reinforcement: "
+    LOG_TRACE << "  Base reinforcement: " << baseReinforcement << std::endl;
+    LOG_TRACE << "  Total bonuses: " << continentBonus << std::endl;
+    LOG_TRACE << "  Final reinforcement: "
               << (baseReinforcement + continentBonus) << std::endl;
 
     return baseReinforcement + continentBonus;
@@ -546,13 +562,8 @@ bool GameEngine::checkWinCondition() {
     if (players.empty())
         return false;
 
-    size_t totalTerritories = 0;
-    for (Continent* continent : currentMap->getContinents()) {
-        totalTerritories += continent->getTerritories().size();
-    }
-
     for (Player* player : players) {
-        if (player->getTerritories().size() == totalTerritories) {
+        if (currentMap->controlsAllTerritories(player)) {
             return true;
         }
     }
@@ -562,23 +573,24 @@ bool GameEngine::checkWinCondition() {
 
 // clang-format off
 void GameEngine::removeDefeatedPlayers() {
-    players.erase(
-		std::remove_if(
-			players.begin(),
-            players.end(),
-            [](Player* player) {
-                if (player->getTerritories().empty()) {
-                    std::cout << "Player "
-                    << player->getName()
-                    << " has been eliminated!"
-                    << std::endl;
-                    return true;
-                }
+    auto firstDefeated = std::stable_partition(
+        players.begin(),
+        players.end(),
+        [](Player* player) {
+            if (player->getTerritories().empty()) {
+                LOG_DEBUG << "Player "
+                << player->getName()
+                << " has been eliminated!"
+                << std::endl;
                 return false;
             }
-		),
-        players.end()
-	);
+            return true;
+        }
+    );
+    // Kept until the game is torn down, so nothing this turn dangles
+    eliminatedPlayers.insert(eliminatedPlayers.end(), firstDefeated,
+                             players.end());
+    players.erase(firstDefeated, players.end());
 }
 // clang-format on
 
@@ -606,14 +618,18 @@ Map* GameEngine::getCurrentMap() const {
     return currentMap;
 }
 
-MapLoader* GameEngine::getMapLoader() const {
-    return mapLoader;
+const RegisteredMap* GameEngine::getCurrentMapEntry() const {
+    return currentMapEntry.get();
 }
 
 LogObserver* GameEngine::getLogObserver() const {
     return logObserver;
 }
 
+const TurnProfile &GameEngine::getTurnProfile() const {
+    return *profile;
+}
+
 StateType GameEngine::getState() {
     return state->getStateType();
 }
@@ -624,21 +640,27 @@ void GameEngine::setState(StateType newState) {
 }
 
 void GameEngine::replay() {
-    std::cout << "\n=== Restarting Game ===" << std::endl;
+    replay(GameContext::randomSeed());
+}
+
+void GameEngine::replay(uint64_t seed) {
+    LOG_DEBUG << "\n=== Restarting Game ===" << std::endl;
 
     // Reset game state
     state->setStateType(StateType::start);
 
     // Clear all players
-    for (Player* player : players) {
-        delete player;
-    }
-    players.clear();
+    deletePlayers();
+
+    // Fresh negotiations, neutral player and random stream for the next game
+    delete context;
+    context = new GameContext(seed);
+    profile->clear();
 
     // Reset deck
     if (deck) {
         delete deck;
-        deck = new Deck();
+        deck = new Deck(context->nextSeed());
     }
 
     // Clear current player
@@ -649,31 +671,101 @@ void GameEngine::replay() {
         delete currentMap;
         currentMap = nullptr;
     }
+    currentMapEntry.reset();
 
-    std::cout << "Game state reset. You can now load a new map and add players."
+    LOG_DEBUG << "Game state reset. You can now load a new map and add players."
               << std::endl;
 }
 
-void GameEngine::runTournament(const Tournament &tournament) {
-    std::cout << "\n=== TOURNAMENT MODE ===" << std::endl;
-    std::cout << "Maps: ";
+std::string GameEngine::playTournamentGame(
+    const std::string &mapFile,
+    const std::vector<std::string> &strategies,
+    int maxTurns,
+    uint64_t seed) {
+    // Reset game state for new game
+    replay(seed);
+    state->setStateType(StateType::start);
+
+    // startupPhase() attaches the observer in console games; tournament
+    // games never run it. Detaching first keeps a reused engine from
+    // logging every line twice.
+    Detach(logObserver);
+    Attach(logObserver);
+
+    // Load map
+    loadMap(mapFile);
+
+    // Validate map
+    validateMap();
+
+    // Add players with tournament strategies
+    for (const std::string &strategyName : strategies) {
+        PlayerStrategy* strategy = nullptr;
+
+        if (strategyName == "Aggressive") {
+            strategy = new AggressivePlayerStrategy();
+        } else if (strategyName == "Benevolent") {
+            strategy = new BenevolentPlayerStrategy();
+        } else if (strategyName == "Neutral") {
+            strategy = new NeutralPlayerStrategy();
+        } else if (strategyName == "Cheater") {
+            strategy = new CheaterPlayerStrategy();
+        } else {
+            strategy = new HumanPlayerStrategy();
+        }
+
+        Player* newPlayer = new Player(strategyName, strategy);
+        newPlayer->setContext(context);
+        players.push_back(newPlayer);
+        newPlayer->getOrdersList()->Attach(logObserver);
+        LOG_DEBUG << "Player added: " << strategyName << std::endl;
+    }
+
+    // Set state to playeradded if we have enough players
+    if (players.size() >= 2) {
+        state->setStateType(StateType::playeradded);
+    }
+
+    // Start the game (distribute territories, armies, cards)
+    gameStart(false);
+
+    // Run game with turn limit
+    mainGameLoop(true, maxTurns);
+
+    // Find winner (player with all territories)
+    for (Player* player : players) {
+        if (currentMap->controlsAllTerritories(player))
+            return player->getName();
+    }
+    return "Draw";
+}
+
+void GameEngine::runTournament(const Tournament &tournament,
+                               unsigned threads) {
+    LOG_INFO << "\n=== TOURNAMENT MODE ===" << std::endl;
+    LOG_INFO << "Maps: ";
     for (size_t i = 0; i < tournament.maps.size(); ++i) {
-        std::cout << tournament.maps[i];
+        LOG_INFO << tournament.maps[i];
         if (i < tournament.maps.size() - 1)
-            std::cout << ", ";
+            LOG_INFO << ", ";
     }
-    std::cout << std::endl;
+    LOG_INFO << std::endl;
 
-    std::cout << "Strategies: ";
+    LOG_INFO << "Strategies: ";
     for (size_t i = 0; i < tournament.strategies.size(); ++i) {
-        std::cout << tournament.strategies[i];
+        LOG_INFO << tournament.strategies[i];
         if (i < tournament.strategies.size() - 1)
-            std::cout << ", ";
-    }
-    std::cout << std::endl;
-    std::cout << "Games per map: " << tournament.numGames << std::endl;
-    std::cout << "Max turns per game: " << tournament.maxTurns << std::endl;
-    std::cout << std::endl;
+            LOG_INFO << ", ";
+    }
+    LOG_INFO << std::endl;
+    LOG_INFO << "Games per map: " << tournament.numGames << std::endl;
+    LOG_INFO << "Max turns per game: " << tournament.maxTurns << std::endl;
+    // Every game's seed derives from this one, so the same seed replays the
+    // whole tournament
+    uint64_t masterSeed =
+        tournament.seeded ? tournament.seed : GameContext::randomSeed();
+    LOG_INFO << "Seed: " << masterSeed << std::endl;
+    LOG_INFO << std::endl;
 
     // Store tournament results: results[mapIndex][gameIndex] = winner
     std::vector<std::vector<std::string>> results;
@@ -682,102 +774,85 @@ void GameEngine::runTournament(const Tournament &tournament) {
         mapResult.resize(tournament.numGames);
     }
 
-    // Run tournament
+    // Load the next map in the background while games run on this one;
+    // loadMap() below then finds it in the registry
+    std::vector<std::string> mapPaths;
+    for (const std::string &mapFile : tournament.maps)
+        mapPaths.push_back(resolveMapPath(mapFile));
+    MapPrefetcher prefetcher(mapPaths);
+
+    // Each game runs on its own engine, so games share nothing they write.
+    // A game's console output and log are buffered, then printed and
+    // appended to gamelog.txt in table order.
+    ThreadPool games(threads);
+    struct GameOutcome {
+        std::string winner;
+        std::string console;
+        std::string log;
+        TurnProfile profile;
+    };
+    std::vector<TurnProfile> mapProfiles(tournament.maps.size());
+    TurnProfile tournamentProfile;
     for (size_t mapIdx = 0; mapIdx < tournament.maps.size(); ++mapIdx) {
         const std::string &mapFile = tournament.maps[mapIdx];
-        std::cout << "Playing on map: " << mapFile << std::endl;
+        LOG_INFO << "Playing on map: " << mapFile << std::endl;
+        // Holding the entry keeps it alive for all of this map's games
+        std::shared_ptr<const RegisteredMap> prefetched = prefetcher.next();
 
+        std::vector<std::future<GameOutcome>> outcomes;
         for (int gameIdx = 0; gameIdx < tournament.numGames; ++gameIdx) {
-            std::cout << "  Game " << (gameIdx + 1) << "/"
-                      << tournament.numGames << "... ";
-
-            // Reset game state for new game
-            replay();
-            state->setStateType(StateType::start);
-
-            // Load map
-            loadMap(mapFile);
-
-            // Validate map
-            validateMap();
-
-            // Add players with tournament strategies
-            for (const std::string &strategyName : tournament.strategies) {
-                PlayerStrategy* strategy = nullptr;
-
-                if (strategyName == "Aggressive") {
-                    strategy = new AggressivePlayerStrategy();
-                } else if (strategyName == "Benevolent") {
-                    strategy = new BenevolentPlayerStrategy();
-                } else if (strategyName == "Neutral") {
-                    strategy = new NeutralPlayerStrategy();
-                } else if (strategyName == "Cheater") {
-                    strategy = new CheaterPlayerStrategy();
-                } else {
-                    strategy = new HumanPlayerStrategy();
-                }
-
-                Player* newPlayer = new Player(strategyName, strategy);
-                players.push_back(newPlayer);
-                newPlayer->getOrdersList()->Attach(logObserver);
-                std::cout << "Player added: " << strategyName << std::endl;
-            }
-
-            // Set state to playeradded if we have enough players
-            if (players.size() >= 2) {
-                state->setStateType(StateType::playeradded);
-            }
-
-            // Start the game (distribute territories, armies, cards)
-            gameStart(false);
-
-            // Run game with turn limit
-            mainGameLoop(true, tournament.maxTurns);
-
-            // Find winner (player with all territories)
-            std::string winner = "Draw";
-            for (Player* player : players) {
-                if (!player->getTerritories().empty()) {
-                    size_t totalTerritories = 0;
-                    for (Continent* continent : currentMap->getContinents()) {
-                        totalTerritories += continent->getTerritories().size();
-                    }
-                    if (player->getTerritories().size() == totalTerritories) {
-                        winner = player->getName();
-                        break;
-                    }
-                }
-            }
+            uint64_t seed =
+                GameContext::gameSeed(masterSeed, mapIdx, gameIdx);
+            outcomes.push_back(games.submit([&tournament, &mapFile, seed]() {
+                std::ostringstream console;
+                std::ostringstream log;
+                LogCapture capture(console);
+                GameEngine engine(nullptr, new LogObserver(&log));
+                std::string winner = engine.playTournamentGame(
+                    mapFile, tournament.strategies, tournament.maxTurns, seed);
+                return GameOutcome{winner, console.str(), log.str(),
+                                   engine.getTurnProfile()};
+            }));
+        }
 
-            results[mapIdx][gameIdx] = winner;
-            std::cout << "Winner: " << winner << std::endl;
+        for (int gameIdx = 0; gameIdx < tournament.numGames; ++gameIdx) {
+            GameOutcome outcome = outcomes[gameIdx].get();
+            results[mapIdx][gameIdx] = outcome.winner;
+            Log::stream() << outcome.console;
+            logObserver->write(outcome.log);
+            mapProfiles[mapIdx].merge(outcome.profile);
+            tournamentProfile.merge(outcome.profile);
+            LOG_INFO << "  Game " << (gameIdx + 1) << "/"
+                     << tournament.numGames << "... Winner: " << outcome.winner
+                     << std::endl;
         }
     }
 
     // Output tournament results
-    std::cout << "\n=== TOURNAMENT RESULTS ===" << std::endl;
-    std::cout << "Maps: ";
+    LOG_RESULT << "\n=== TOURNAMENT RESULTS ===" << std::endl;
+    LOG_RESULT << "Maps: ";
     for (size_t i = 0; i < tournament.maps.size(); ++i) {
-        std::cout << tournament.maps[i];
+        LOG_RESULT << tournament.maps[i];
         if (i < tournament.maps.size() - 1)
-            std::cout << ", ";
+            LOG_RESULT << ", ";
     }
-    std::cout << std::endl;
+    LOG_RESULT << std::endl;
 
-    std::cout << "Strategies: ";
+    LOG_RESULT << "Strategies: ";
     for (size_t i = 0; i < tournament.strategies.size(); ++i) {
-        std::cout << tournament.strategies[i];
+        LOG_RESULT << tournament.strategies[i];
         if (i < tournament.strategies.size() - 1)
-            std::cout << ", ";
+            LOG_RESULT << ", ";
     }
-    std::cout << std::endl;
+    LOG_RESULT << std::endl;
 
-    std::cout << "Games per map: " << tournament.numGames << std::endl;
-    std::cout << "Max turns: " << tournament.maxTurns << std::endl;
-    std::cout << std::endl;
+    LOG_RESULT << "Games per map: " << tournament.numGames << std::endl;
+    LOG_RESULT << "Max turns: " << tournament.maxTurns << std::endl;
+    LOG_RESULT << "Seed: " << masterSeed << std::endl;
+    LOG_RESULT << std::endl;
 
     // Print results table
-    std::cout << "Results:" << std::endl;
+    LOG_RESULT << "Results:" << std::endl;
     
     // Find the maximum width needed for map names
     size_t maxMapNameWidth = 12;
@@ -798,27 +873,40 @@ void GameEngine::runTournament(const Tournament &tournament) {
     }
     
     // Print header
-    std::cout << std::left << std::setw(maxMapNameWidth) << "Map \\ Game";
+    LOG_RESULT << std::left << std::setw(maxMapNameWidth) << "Map \\ Game";
     for (int g = 1; g <= tournament.numGames; ++g) {
-        std::cout << std::setw(maxCellWidth + 2) << ("Game " + std::to_string(g));
+        LOG_RESULT << std::setw(maxCellWidth + 2) << ("Game " + std::to_string(g));
     }
-    std::cout << std::endl;
+    LOG_RESULT << std::endl;
     
     // Print separator
-    std::cout << std::string(maxMapNameWidth, '-');
+    LOG_RESULT << std::string(maxMapNameWidth, '-');
     for (int g = 0; g < tournament.numGames; ++g) {
-        std::cout << std::string(maxCellWidth + 2, '-');
+        LOG_RESULT << std::string(maxCellWidth + 2, '-');
     }
-    std::cout << std::endl;
+    LOG_RESULT << std::endl;
 
     // Print results rows
     for (size_t mapIdx = 0; mapIdx < tournament.maps.size(); ++mapIdx) {
-        std::cout << std::left << std::setw(maxMapNameWidth) << tournament.maps[mapIdx];
+        LOG_RESULT << std::left << std::setw(maxMapNameWidth) << tournament.maps[mapIdx];
         for (int gameIdx = 0; gameIdx < tournament.numGames; ++gameIdx) {
-            std::cout << std::setw(maxCellWidth + 2) << results[mapIdx][gameIdx];
+            LOG_RESULT << std::setw(maxCellWidth + 2) << results[mapIdx][gameIdx];
+        }
+        LOG_RESULT << std::endl;
+    }
+
+    // Phase timings per map and overall, when profiling is on
+    if (Profiler::isEnabled()) {
+        std::ostringstream tables;
+        for (size_t mapIdx = 0; mapIdx < tournament.maps.size(); ++mapIdx) {
+            tables << "\n";
+            mapProfiles[mapIdx].print(tables, tournament.maps[mapIdx]);
         }
-        std::cout << std::endl;
+        tables << "\n";
+        tournamentProfile.print(tables, "all maps");
+        LOG_RESULT << tables.str();
     }
+    LOG_INFO << "\n" << prefetcher << std::endl;
 
     state->setStateType(StateType::win);
 }
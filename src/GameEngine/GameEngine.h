@@ -2,18 +2,22 @@
 #include "CommandProcessor/CommandProcessor.h"
 #include "LoggingObserver/LoggingObserver.h"
 #include "Map/Map.h"
-#include "Map/MapLoader.h"
+#include "Map/MapRegistry.h"
 #include "Player/Player.h"
+#include "TurnProfile.h"
 #include "Utils/Utils.h"
+#include <cstdint>
 #include <filesystem>
 #include <iostream>
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
 // Forward declarations
 class State;
 class GameEngine;
+class GameContext;
 
 void printInvalidCommandError();
 
@@ -41,19 +45,33 @@ class State {
 class GameEngine : public ILoggable, public Subject {
   private:
     State* state;
-    MapLoader* mapLoader;
     std::string* currentMapPath;
+    // Registry entry the current map was instantiated from
+    std::shared_ptr<const RegisteredMap> currentMapEntry;
     Map* currentMap;
     Player* currentPlayer;
+    GameContext* context; // Negotiations, neutral player and randomness
     Deck* deck;
     CommandProcessor* commandProcessor;
     LogObserver* logObserver;
+    TurnProfile* profile; // This game's phase timings (see Profiler)
     std::vector<Player*> players;
+    std::vector<Player*> eliminatedPlayers; // Deleted with the game
+
+    // Map files are looked up in res/ under the working directory
+    static std::string resolveMapPath(const std::string &filename);
+    // Deletes the players, eliminated ones included, with their strategies
+    // and the cards in their hands
+    void deletePlayers();
 
   public:
-    explicit GameEngine(CommandProcessor* cmdProcessor);
-    GameEngine(const GameEngine &other);
-    GameEngine &operator=(const GameEngine &other);
+    // The engine takes ownership of observer; without one it logs to
+    // gamelog.txt
+    explicit GameEngine(CommandProcessor* cmdProcessor,
+                        LogObserver* observer = nullptr);
+    // An engine owns its players, map and deck outright; it is not copied
+    GameEngine(const GameEngine &) = delete;
+    GameEngine &operator=(const GameEngine &) = delete;
     virtual ~GameEngine();
 
     // Command methods
@@ -62,8 +80,17 @@ class GameEngine : public ILoggable, public Subject {
     void validateMap();
     void addPlayer(const std::string &playerName);
     void gameStart(bool runMainLoop = true);
-    void replay();
-    void runTournament(const Tournament &tournament);
+    void replay(); // Next game gets a random seed
+    void replay(uint64_t seed);
+    // Plays every game on its own engine across threads workers (0 uses
+    // every hardware thread)
+    void runTournament(const Tournament &tournament, unsigned threads = 0);
+    // Resets this engine, plays one game to maxTurns and returns the
+    // winner's strategy or "Draw". The same seed plays the same game.
+    std::string playTournamentGame(const std::string &mapFile,
+                                   const std::vector<std::string> &strategies,
+                                   int maxTurns,
+                                   uint64_t seed);
 
     // Main phases
     void mainGameLoop(bool runExecuteOrdersPhase = true, int maxTurns = -1);
@@ -86,9 +113,10 @@ class GameEngine : public ILoggable, public Subject {
     const std::vector<Player*> &getPlayers() const;
     Player* getCurrentPlayer() const;
     Map* getCurrentMap() const;
-    MapLoader* getMapLoader() const;
+    const RegisteredMap* getCurrentMapEntry() const;
     Deck* getDeck() const;
     LogObserver* getLogObserver() const;
+    const TurnProfile &getTurnProfile() const;
     CommandProcessor &getCommandProcessor();
     StateType getState();
     void setState(StateType newState);
@@ -100,4 +128,9 @@ class GameEngine : public ILoggable, public Subject {
 };
 
 // Tournament test driver
-void testTournament();
\ No newline at end of file
+void testTournament();
+// Plays one seeded tournament game twice and checks both runs match
+void testTournamentReplay();
+// Runs a seeded tournament on two threads and checks its log lists each
+// game once, whole and in table order
+void testTournamentLog();
\ No newline at end of file
@@ -1,7 +1,9 @@
 #include "CommandProcessor/CommandProcessor.h"
+#include "GameContext.h"
 #include "GameEngine.h"
 #include "LoggingObserver/LoggingObserver.h"
 #include <iostream>
+#include <sstream>
 
 void testTournament() {
     std::cout << "\n=== Testing Tournament Mode ===\n" << std::endl;
@@ -42,4 +44,76 @@ void testTournament() {
     delete cmdProcessor;
     delete gameEngine;
     delete logObserver;
+
+    testTournamentReplay();
+    testTournamentLog();
 }
+
+void testTournamentReplay() {
+    std::cout << "\nTesting that a seed replays its game..." << std::endl;
+
+    // Play the first game of a tournament seeded with 12345 twice, each on
+    // its own engine, and compare the winners and the full game logs
+    uint64_t seed = GameContext::gameSeed(12345, 0, 0);
+    std::vector<std::string> strategies = {"Aggressive", "Benevolent"};
+    std::string winners[2];
+    std::string logs[2];
+    for (int run = 0; run < 2; ++run) {
+        std::ostringstream log;
+        GameEngine engine(nullptr, new LogObserver(&log));
+        winners[run] =
+            engine.playTournamentGame("Moon.map", strategies, 30, seed);
+        logs[run] = log.str();
+    }
+
+    if (winners[0] == winners[1] && logs[0] == logs[1])
+        std::cout << "Seed " << seed << " replayed the same game, won by "
+                  << winners[0] << "." << std::endl;
+    else
+        std::cout << "**ERROR**: Seed " << seed << " gave " << winners[0]
+                  << " then " << winners[1]
+                  << (logs[0] == logs[1] ? "" : " with different logs")
+                  << std::endl;
+}
+
+void testTournamentLog() {
+    std::cout << "\nTesting the tournament log..." << std::endl;
+
+    // A seeded tournament on two threads, logged to memory
+    Tournament tournament{{"Moon.map"}, {"Aggressive", "Benevolent"}, 3, 30};
+    tournament.seeded = true;
+    tournament.seed = 12345;
+    std::ostringstream log;
+    {
+        GameEngine engine(nullptr, new LogObserver(&log));
+        engine.runTournament(tournament, 2);
+    }
+
+    // Each game must log its state changes once, and its whole log must
+    // appear unbroken and in table order, whatever thread played it
+    std::string expected;
+    for (int gameIdx = 0; gameIdx < tournament.numGames; ++gameIdx) {
+        std::ostringstream gameLog;
+        GameEngine engine(nullptr, new LogObserver(&gameLog));
+        engine.playTournamentGame(
+            tournament.maps[0], tournament.strategies, tournament.maxTurns,
+            GameContext::gameSeed(tournament.seed, 0, gameIdx));
+        expected += gameLog.str();
+    }
+
+    std::string text = log.str();
+    int mapsLoaded = 0;
+    const std::string loaded = "GameEngine state changed to: maploaded";
+    for (size_t pos = text.find(loaded); pos != std::string::npos;
+         pos = text.find(loaded, pos + 1))
+        ++mapsLoaded;
+
+    if (mapsLoaded == tournament.numGames && text == expected)
+        std::cout << "The log holds all " << tournament.numGames
+                  << " games in table order." << std::endl;
+    else
+        std::cout << "**ERROR**: The log shows " << mapsLoaded
+                  << " map loads for " << tournament.numGames << " games"
+                  << (text == expected ? "" : " and is out of order")
+                  << std::endl;
+}
\ No newline at end of file
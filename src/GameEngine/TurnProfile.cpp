@@ -0,0 +1,83 @@
+#include "TurnProfile.h"
+#include <iomanip>
+
+Histogram &TurnProfile::phase(TurnPhase turnPhase) {
+    return phases[static_cast<size_t>(turnPhase)];
+}
+
+Histogram &TurnProfile::issueOrder(const std::string &strategyName) {
+    return strategies[strategyName];
+}
+
+void TurnProfile::merge(const TurnProfile &other) {
+    for (size_t p = 0; p < phases.size(); ++p)
+        phases[p].merge(other.phases[p]);
+    for (const auto &[name, histogram] : other.strategies)
+        strategies[name].merge(histogram);
+}
+
+void TurnProfile::clear() {
+    for (Histogram &histogram : phases)
+        histogram.clear();
+    strategies.clear();
+}
+
+bool TurnProfile::empty() const {
+    for (const Histogram &histogram : phases) {
+        if (histogram.getCount() != 0)
+            return false;
+    }
+    return strategies.empty();
+}
+
+const char* TurnProfile::phaseName(TurnPhase turnPhase) {
+    switch (turnPhase) {
+        case TurnPhase::Reinforcement:
+            return "reinforcement";
+        case TurnPhase::IssueOrders:
+            return "issue orders";
+        case TurnPhase::ExecuteOrders:
+            return "execute orders";
+        case TurnPhase::RemoveDefeated:
+            return "remove defeated";
+        case TurnPhase::CheckWin:
+            return "check win";
+        case TurnPhase::Count:
+            break;
+    }
+    return "unknown";
+}
+
+namespace {
+void printRow(std::ostream &os,
+              const std::string &section,
+              const Histogram &histogram) {
+    auto micros = [](double nanoseconds) { return nanoseconds / 1000.0; };
+    os << std::left << std::setw(26) << section << std::right << std::setw(8)
+       << histogram.getCount() << std::fixed << std::setprecision(2)
+       << std::setw(11) << histogram.getTotal() / 1e6 << std::setw(10)
+       << micros(histogram.getMean()) << std::setw(10)
+       << micros(histogram.percentile(0.5)) << std::setw(10)
+       << micros(histogram.percentile(0.9)) << std::setw(10)
+       << micros(histogram.percentile(0.99)) << std::setw(10)
+       << micros(histogram.getMax()) << std::defaultfloat << "\n";
+}
+} // namespace
+
+void TurnProfile::print(std::ostream &os, const std::string &title) const {
+    os << "=== TURN PROFILE: " << title << " ===\n";
+    os << std::left << std::setw(26) << "Section" << std::right
+       << std::setw(8) << "Calls" << std::setw(11) << "Total ms"
+       << std::setw(10) << "Mean us" << std::setw(10) << "p50 us"
+       << std::setw(10) << "p90 us" << std::setw(10) << "p99 us"
+       << std::setw(10) << "Max us" << "\n";
+    for (size_t p = 0; p < phases.size(); ++p) {
+        TurnPhase turnPhase = static_cast<TurnPhase>(p);
+        printRow(os, phaseName(turnPhase), phases[p]);
+        // Per-strategy issueOrder() calls nest under the issue phase
+        if (turnPhase == TurnPhase::IssueOrders) {
+            for (const auto &[name, histogram] : strategies)
+                printRow(os, "  " + name + " issueOrder", histogram);
+        }
+    }
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include "Utils/Profiler.h"
+#include <array>
+#include <iostream>
+#include <map>
+#include <string>
+
+// Timed sections of GameEngine::mainGameLoop
+enum class TurnPhase {
+    Reinforcement,
+    IssueOrders,
+    ExecuteOrders,
+    RemoveDefeated,
+    CheckWin,
+    Count
+};
+
+// Where a game's turns spend their time: one histogram per phase, plus one
+// per strategy for the players' issueOrder() calls. Profiles of several
+// games merge, which is how a tournament builds its per-map and overall
+// tables. Only filled while Profiler is enabled.
+class TurnProfile {
+  private:
+    std::array<Histogram, static_cast<size_t>(TurnPhase::Count)> phases;
+    std::map<std::string, Histogram> strategies; // Keyed by strategy name
+
+  public:
+    Histogram &phase(TurnPhase turnPhase);
+    Histogram &issueOrder(const std::string &strategyName);
+
+    void merge(const TurnProfile &other);
+    void clear();
+    bool empty() const;
+
+    // Count, total and percentiles of every section, one row each
+    void print(std::ostream &os, const std::string &title) const;
+
+    static const char* phaseName(TurnPhase turnPhase);
+};
@@ -123,7 +123,8 @@ std::string getCommandArgsString(CommandType command) {
     if (command == CommandType::quit)
         return "";
     if (command == CommandType::tournament)
-        return "-M maplist -P strategylist -G numgames -D maxturn";
+        return "-M maplist -P strategylist -G numgames -D maxturn "
+               "[-S seed]";
     return "invalid";
 }
 
@@ -1,4 +1,5 @@
 #include "LoggingObserver/LoggingObserver.h"
+#include "Utils/Log.h"
 #include <fstream>
 #include <iostream>
 
@@ -31,24 +32,33 @@ void Subject::Notify(ILoggable* loggable) {
 }
 
 //---------------------------LogObserver----------------------------
-bool LogObserver::fileCleared = false;
+std::once_flag LogObserver::fileCleared;
+std::mutex LogObserver::fileMutex;
 
-LogObserver::LogObserver() {
+LogObserver::LogObserver() : sink(nullptr) {
     // Clear the log file on first LogObserver creation
-    if (!fileCleared) {
+    std::call_once(fileCleared, []() {
         std::ofstream logfile("gamelog.txt", std::ios::trunc);
-        logfile.close();
-        fileCleared = true;
-    }
+    });
 }
 
+LogObserver::LogObserver(std::ostream* sink) : sink(sink) {}
+
 LogObserver::~LogObserver() = default;
 
 void LogObserver::Update(ILoggable* loggable) {
     std::string line = loggable->stringToLog();
-    std::fstream logfile("gamelog.txt", std::ios::app);
-    logfile << line << std::endl;
-    logfile.close();
+    write(line + "\n");
 
-    std::cout << line << std::endl;
+    LOG_TRACE << line << std::endl;
+}
+
+void LogObserver::write(const std::string &text) {
+    if (sink) {
+        *sink << text;
+        return;
+    }
+    std::lock_guard<std::mutex> lock(fileMutex);
+    std::ofstream logfile("gamelog.txt", std::ios::app);
+    logfile << text;
 }
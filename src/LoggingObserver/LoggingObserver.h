@@ -1,5 +1,7 @@
 #pragma once
 #include <list>
+#include <mutex>
+#include <ostream>
 #include <string>
 
 // Forward declarations
@@ -32,13 +34,22 @@ class Subject {
     std::list<Observer*>* observers;
 };
 
-// LogObserver - concrete observer that logs to gamelog.txt
+// LogObserver - concrete observer that logs to gamelog.txt, or to a stream
+// of the caller's when a game keeps its own log (e.g. tournament games
+// running in parallel, whose logs are appended once they finish)
 class LogObserver : public Observer {
   private:
-    static bool fileCleared; // Track if file has been cleared this run
+    std::ostream* sink; // nullptr: gamelog.txt
+
+    static std::once_flag fileCleared; // Truncated once per run
+    static std::mutex fileMutex;       // Appends from concurrent games
 
   public:
     LogObserver();
+    explicit LogObserver(std::ostream* sink);
     virtual ~LogObserver();
     void Update(ILoggable* loggable) override;
+
+    // Appends text (one or more lines) to the log without echoing it
+    void write(const std::string &text);
 };
@@ -11,10 +11,30 @@
 #include "Player/Player.h"
 #include "Player/PlayerDriver.h"
 #include "PlayerStrategies/PlayerStrategiesDriver.h"
+#include "Utils/Log.h"
+#include "Utils/Profiler.h"
 #include "Utils/Utils.h"
 #include <iostream>
 
 int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
+    // --log-level trace|debug|info|result|off picks how much game output
+    // is printed; levels below the build's floor are compiled out anyway.
+    // --profile times the phases of every turn and prints the tables after
+    // each game or tournament.
+    for (int i = 1; i < argc; ++i) {
+        std::string flag = argv[i];
+        if (flag == "--profile") {
+            Profiler::setEnabled(true);
+            continue;
+        }
+        if (flag != "--log-level" || i + 1 >= argc)
+            continue;
+        LogLevel level;
+        if (Log::parseLevel(argv[i + 1], level))
+            Log::setLevel(level);
+        else
+            std::cout << "Unknown log level: " << argv[i + 1] << std::endl;
+    }
 
     // std::cout << "\n" << SEPARATOR_LINE << std::endl;
     // std::cout << "ASSIGNMENT 1" << std::endl;
@@ -0,0 +1,309 @@
+#include "CompiledMap.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "Map.h"
+#include "StreamingValidator.h"
+#include "Utils/MappedFile.h"
+
+// ---------- on-disk layout -----------------
+// Header, ContinentRecord[continentCount], TerritoryRecord[territoryCount],
+// int32 offsets[territoryCount + 1], int32 ids[edgeCount], then the name
+// blob. Records are read with memcpy, so nothing depends on alignment.
+namespace {
+const char Magic[4] = {'W', 'Z', 'M', '1'};
+const uint32_t ByteOrderMark = 0x01020304;
+const uint32_t WrapFlag = 1;
+const uint32_t WarnFlag = 2;
+
+// A name as a range of the blob
+struct StringRef {
+    uint32_t offset;
+    uint32_t length;
+};
+
+struct Header {
+    char magic[4];
+    uint32_t byteOrder;
+    uint32_t version;
+    uint32_t flags;
+    uint64_t sourceHash;
+    uint64_t sourceSize;
+    uint32_t territoryCount;
+    uint32_t continentCount;
+    uint32_t edgeCount;
+    uint32_t reserved;
+    uint64_t stringBytes;
+    StringRef author;
+    StringRef image;
+    StringRef scroll;
+};
+
+struct ContinentRecord {
+    StringRef name;
+    int32_t bonus;
+};
+
+struct TerritoryRecord {
+    StringRef name;
+    int32_t x;
+    int32_t y;
+    int32_t continentId;
+};
+
+static_assert(sizeof(Header) == 80, "unexpected header padding");
+static_assert(sizeof(ContinentRecord) == 12, "unexpected record padding");
+static_assert(sizeof(TerritoryRecord) == 20, "unexpected record padding");
+static_assert(std::is_trivially_copyable<Header>::value, "header not POD");
+
+// Appends names to the blob and hands back their ranges
+class StringBlob {
+  public:
+    std::string bytes;
+
+    StringRef add(std::string_view s) {
+        StringRef ref{static_cast<uint32_t>(bytes.size()),
+                      static_cast<uint32_t>(s.size())};
+        bytes.append(s.data(), s.size());
+        return ref;
+    }
+};
+
+template <typename T> void writeRaw(std::ofstream &out, const T* data,
+                                    size_t count) {
+    out.write(reinterpret_cast<const char*>(data),
+              static_cast<std::streamsize>(sizeof(T) * count));
+}
+
+// Sequential reader over the mapped cache; every read is bounds checked
+class Cursor {
+  private:
+    const char* pos;
+    const char* end;
+
+  public:
+    Cursor(const char* begin, const char* end) : pos(begin), end(end) {}
+
+    template <typename T> bool read(T* out, size_t count) {
+        size_t bytes = sizeof(T) * count;
+        if (static_cast<size_t>(end - pos) < bytes)
+            return false;
+        std::memcpy(out, pos, bytes);
+        pos += bytes;
+        return true;
+    }
+
+    const char* position() const { return pos; }
+    size_t remaining() const { return static_cast<size_t>(end - pos); }
+};
+
+bool resolve(const StringRef &ref, std::string_view blob,
+             std::string_view &out) {
+    if (ref.offset > blob.size() || ref.length > blob.size() - ref.offset)
+        return false;
+    out = blob.substr(ref.offset, ref.length);
+    return true;
+}
+} // namespace
+
+// ---------- CompiledMap implementation -----------------
+
+std::string CompiledMap::cachePathFor(const std::string &mapPath) {
+    const std::string extension = ".map";
+    if (mapPath.size() >= extension.size()
+        && mapPath.compare(mapPath.size() - extension.size(),
+                           extension.size(), extension)
+               == 0)
+        return mapPath.substr(0, mapPath.size() - extension.size()) + ".wzm";
+    return mapPath + ".wzm";
+}
+
+bool CompiledMap::write(const Map &map,
+                        const std::string &path,
+                        uint64_t sourceHash,
+                        uint64_t sourceSize) {
+    map.buildAdjacencyIndex();
+
+    const std::vector<Continent*> &continents = map.getContinents();
+    const std::vector<Territory*> &territories = map.getTerritories();
+    StringBlob blob;
+
+    Header header{};
+    std::memcpy(header.magic, Magic, sizeof(Magic));
+    header.byteOrder = ByteOrderMark;
+    header.version = FormatVersion;
+    header.flags = (map.getWrap() ? WrapFlag : 0)
+                   | (map.getWarn() ? WarnFlag : 0);
+    header.sourceHash = sourceHash;
+    header.sourceSize = sourceSize;
+    header.territoryCount = static_cast<uint32_t>(territories.size());
+    header.continentCount = static_cast<uint32_t>(continents.size());
+    header.author = blob.add(map.getAuthor());
+    header.image = blob.add(map.getImage());
+    header.scroll = blob.add(map.getScroll());
+
+    std::vector<ContinentRecord> continentRecords;
+    continentRecords.reserve(continents.size());
+    for (const Continent* continent : continents)
+        continentRecords.push_back(
+            {blob.add(continent->getNameView()), continent->getBonus()});
+
+    std::vector<TerritoryRecord> territoryRecords;
+    territoryRecords.reserve(territories.size());
+    std::vector<int32_t> offsets(1, 0);
+    offsets.reserve(territories.size() + 1);
+    std::vector<int32_t> ids;
+    for (const Territory* territory : territories) {
+        territoryRecords.push_back({blob.add(territory->getNameView()),
+                                    territory->getX(), territory->getY(),
+                                    territory->getContinentId()});
+        for (int neighborId : map.getNeighborIds(territory->getId()))
+            ids.push_back(neighborId);
+        offsets.push_back(static_cast<int32_t>(ids.size()));
+    }
+    header.edgeCount = static_cast<uint32_t>(ids.size());
+    header.stringBytes = blob.bytes.size();
+
+    // Unique per writer so two threads compiling the same map don't
+    // interleave their bytes; the rename then replaces the cache atomically
+    std::string tempPath =
+        path + ".tmp"
+        + std::to_string(std::hash<std::thread::id>{}(
+            std::this_thread::get_id()));
+    {
+        std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+        if (!out)
+            return false;
+        writeRaw(out, &header, 1);
+        writeRaw(out, continentRecords.data(), continentRecords.size());
+        writeRaw(out, territoryRecords.data(), territoryRecords.size());
+        writeRaw(out, offsets.data(), offsets.size());
+        writeRaw(out, ids.data(), ids.size());
+        writeRaw(out, blob.bytes.data(), blob.bytes.size());
+        if (!out.flush()) {
+            out.close();
+            std::remove(tempPath.c_str());
+            return false;
+        }
+    }
+    if (std::rename(tempPath.c_str(), path.c_str()) != 0) {
+        std::remove(tempPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+Map* CompiledMap::read(const std::string &path,
+                       uint64_t sourceHash,
+                       uint64_t sourceSize,
+                       const std::string &worldName,
+                       StreamingValidator* validator) {
+    MappedFile file(path);
+    if (!file.isOpen())
+        return nullptr;
+
+    Cursor cursor(file.data(), file.data() + file.size());
+    Header header;
+    if (!cursor.read(&header, 1))
+        return nullptr;
+    if (std::memcmp(header.magic, Magic, sizeof(Magic)) != 0
+        || header.byteOrder != ByteOrderMark
+        || header.version != FormatVersion
+        || header.sourceHash != sourceHash
+        || header.sourceSize != sourceSize)
+        return nullptr;
+
+    // The sections must fill the file exactly
+    uint64_t n = header.territoryCount;
+    uint64_t expected = sizeof(ContinentRecord) * header.continentCount
+                        + sizeof(TerritoryRecord) * n
+                        + sizeof(int32_t) * (n + 1)
+                        + sizeof(int32_t) * uint64_t(header.edgeCount)
+                        + header.stringBytes;
+    if (expected != cursor.remaining())
+        return nullptr;
+
+    std::vector<ContinentRecord> continentRecords(header.continentCount);
+    std::vector<TerritoryRecord> territoryRecords(header.territoryCount);
+    std::vector<int32_t> offsets(n + 1);
+    std::vector<int32_t> ids(header.edgeCount);
+    cursor.read(continentRecords.data(), continentRecords.size());
+    cursor.read(territoryRecords.data(), territoryRecords.size());
+    cursor.read(offsets.data(), offsets.size());
+    cursor.read(ids.data(), ids.size());
+    std::string_view blob(cursor.position(), header.stringBytes);
+
+    // Check every index before building anything
+    if (offsets[0] != 0 || offsets[n] != static_cast<int32_t>(ids.size()))
+        return nullptr;
+    for (size_t i = 0; i < n; ++i) {
+        if (offsets[i] > offsets[i + 1])
+            return nullptr;
+    }
+    for (int32_t id : ids) {
+        if (id < 0 || static_cast<uint64_t>(id) >= n)
+            return nullptr;
+    }
+    std::string_view author, image, scroll;
+    if (!resolve(header.author, blob, author)
+        || !resolve(header.image, blob, image)
+        || !resolve(header.scroll, blob, scroll))
+        return nullptr;
+    std::vector<std::string_view> continentNames(continentRecords.size());
+    for (size_t c = 0; c < continentRecords.size(); ++c) {
+        if (!resolve(continentRecords[c].name, blob, continentNames[c]))
+            return nullptr;
+    }
+    std::vector<std::string_view> territoryNames(territoryRecords.size());
+    for (size_t i = 0; i < territoryRecords.size(); ++i) {
+        const TerritoryRecord &record = territoryRecords[i];
+        if (!resolve(record.name, blob, territoryNames[i])
+            || record.continentId < -1
+            || record.continentId
+                   >= static_cast<int32_t>(header.continentCount))
+            return nullptr;
+    }
+
+    Map* map = new Map((header.flags & WrapFlag) != 0,
+                       (header.flags & WarnFlag) != 0, std::string(author),
+                       std::string(image), worldName, std::string(scroll));
+    map->reserve(territoryRecords.size(), continentRecords.size());
+
+    for (size_t c = 0; c < continentRecords.size(); ++c) {
+        map->addContinent(new Continent(std::string(continentNames[c]),
+                                        continentRecords[c].bonus));
+        if (validator)
+            validator->addContinent();
+    }
+
+    const std::vector<Continent*> &continents = map->getContinents();
+    for (size_t i = 0; i < territoryRecords.size(); ++i) {
+        const TerritoryRecord &record = territoryRecords[i];
+        Territory* territory =
+            map->createTerritory(territoryNames[i], record.x, record.y);
+        if (record.continentId >= 0)
+            continents[record.continentId]->addTerritory(territory);
+        if (validator) {
+            validator->addTerritory(record.continentId);
+            if (record.continentId >= 0)
+                validator->addMembership(territory->getId());
+        }
+    }
+
+    const std::vector<Territory*> &territories = map->getTerritories();
+    for (size_t i = 0; i < n; ++i) {
+        for (int32_t e = offsets[i]; e < offsets[i + 1]; ++e) {
+            territories[i]->addAdjacentTerritory(territories[ids[e]]);
+            if (validator)
+                validator->addEdge(static_cast<int>(i), ids[e]);
+        }
+    }
+    map->buildAdjacencyIndex();
+    return map;
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+class Map;
+class StreamingValidator;
+
+// Binary form of a parsed .map file (.wzm), written next to the source so
+// later loads skip the text parser. The file holds the [Map] details, the
+// continents with their bonuses, the territories with their coordinates and
+// continent, the CSR adjacency and one blob with every name. It records the
+// FNV-1a hash and size of the source it was compiled from; a cache whose
+// source no longer matches, or that fails any bounds check, is rejected.
+//
+// Integers are stored in the host's byte order; a cache moved to a host
+// with a different order fails the header check and is recompiled.
+class CompiledMap {
+  public:
+    static constexpr uint32_t FormatVersion = 1;
+
+    // Path of the cache for a source map: "world.map" -> "world.wzm"
+    static std::string cachePathFor(const std::string &mapPath);
+
+    // Writes the cache for a fully indexed map. The file is written under a
+    // temporary name and renamed into place, so readers never see a partial
+    // cache. Returns false if it could not be written.
+    static bool write(const Map &map,
+                      const std::string &path,
+                      uint64_t sourceHash,
+                      uint64_t sourceSize);
+
+    // Rebuilds a map from the cache at path, or returns nullptr if the cache
+    // is missing, corrupt, or compiled from a different source. A validator,
+    // if given, sees every territory and edge as they are added.
+    static Map* read(const std::string &path,
+                     uint64_t sourceHash,
+                     uint64_t sourceSize,
+                     const std::string &worldName,
+                     StreamingValidator* validator = nullptr);
+};
@@ -0,0 +1,133 @@
+#include "FrontierIndex.h"
+#include "Map.h"
+
+namespace {
+const SparseSet emptyFrontier;
+} // namespace
+
+void FrontierIndex::build(const Map &map) {
+    const TerritoryStore &store = map.getStore();
+    int n = map.getTerritoryCount();
+
+    touching.clear();
+    enemyFrontiers.clear();
+    ownedFrontiers.clear();
+    foreignNeighbors.assign(n, 0);
+    addOwnerSlots(map, static_cast<int>(store.getOwnerTable().size()) - 1);
+
+    for (int id = 0; id < n; ++id) {
+        int owner = store.getOwnerIndex(id);
+        for (int neighborId : map.getNeighborIds(id)) {
+            if (owner >= 0)
+                ++touching[owner][neighborId];
+            if (store.getOwnerIndex(neighborId) != owner)
+                ++foreignNeighbors[id];
+        }
+    }
+
+    for (size_t owner = 0; owner < touching.size(); ++owner) {
+        for (int id = 0; id < n; ++id)
+            updateEnemy(map, static_cast<int>(owner), id);
+    }
+    for (int id = 0; id < n; ++id)
+        updateOwned(map, id);
+
+    version = store.getOwnershipVersion();
+    built = true;
+}
+
+void FrontierIndex::clear() {
+    touching.clear();
+    foreignNeighbors.clear();
+    enemyFrontiers.clear();
+    ownedFrontiers.clear();
+    built = false;
+}
+
+bool FrontierIndex::isCurrent(const Map &map) const {
+    return built && version == map.getStore().getOwnershipVersion();
+}
+
+// Owner slots are only ever appended, so new ones start out empty
+void FrontierIndex::addOwnerSlots(const Map &map, int ownerIndex) {
+    size_t n = static_cast<size_t>(map.getTerritoryCount());
+    while (static_cast<int>(touching.size()) <= ownerIndex) {
+        touching.emplace_back(n, 0);
+        enemyFrontiers.emplace_back(n);
+        ownedFrontiers.emplace_back(n);
+    }
+}
+
+void FrontierIndex::updateEnemy(const Map &map, int ownerIndex, int id) {
+    bool member = touching[ownerIndex][id] > 0
+        && map.getStore().getOwnerIndex(id) != ownerIndex;
+    enemyFrontiers[ownerIndex].assign(id, member);
+}
+
+void FrontierIndex::updateOwned(const Map &map, int id) {
+    int owner = map.getStore().getOwnerIndex(id);
+    if (owner >= 0)
+        ownedFrontiers[owner].assign(id, foreignNeighbors[id] > 0);
+}
+
+// Only the previous and next owners' frontiers can change: for any other
+// owner the territory was and still is someone else's.
+void FrontierIndex::ownerChanged(const Map &map,
+                                 int id,
+                                 int previous,
+                                 int next) {
+    const TerritoryStore &store = map.getStore();
+    addOwnerSlots(map, next);
+
+    // Edges out of the territory now touch its neighbours for next instead
+    for (int neighborId : map.getNeighborIds(id)) {
+        if (previous >= 0) {
+            --touching[previous][neighborId];
+            updateEnemy(map, previous, neighborId);
+        }
+        if (next >= 0) {
+            ++touching[next][neighborId];
+            updateEnemy(map, next, neighborId);
+        }
+    }
+    if (previous >= 0) {
+        updateEnemy(map, previous, id);
+        ownedFrontiers[previous].erase(id);
+    }
+    if (next >= 0)
+        updateEnemy(map, next, id);
+
+    // Recount the territory's own foreign edges
+    foreignNeighbors[id] = 0;
+    for (int neighborId : map.getNeighborIds(id)) {
+        if (store.getOwnerIndex(neighborId) != next)
+            ++foreignNeighbors[id];
+    }
+    updateOwned(map, id);
+
+    // Territories with an edge into this one see it change sides
+    for (int neighborId : map.getIncomingNeighborIds(id)) {
+        if (neighborId == id)
+            continue;
+        int owner = store.getOwnerIndex(neighborId);
+        if (owner == previous)
+            ++foreignNeighbors[neighborId];
+        else if (owner == next)
+            --foreignNeighbors[neighborId];
+        updateOwned(map, neighborId);
+    }
+
+    version = store.getOwnershipVersion();
+}
+
+const SparseSet &FrontierIndex::getEnemyFrontier(int ownerIndex) const {
+    if (ownerIndex < 0 || ownerIndex >= static_cast<int>(enemyFrontiers.size()))
+        return emptyFrontier;
+    return enemyFrontiers[ownerIndex];
+}
+
+const SparseSet &FrontierIndex::getOwnedFrontier(int ownerIndex) const {
+    if (ownerIndex < 0 || ownerIndex >= static_cast<int>(ownedFrontiers.size()))
+        return emptyFrontier;
+    return ownedFrontiers[ownerIndex];
+}
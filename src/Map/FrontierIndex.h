@@ -0,0 +1,43 @@
+#pragma once
+#include "Utils/SparseSet.h"
+#include <vector>
+
+// Forward declarations
+class Map;
+
+// Per-owner frontiers kept up to date as territories change hands.
+// For each owner table slot it tracks the enemy frontier (territories held by
+// someone else that an owned territory has an edge to) and the owned
+// frontier (owned territories with an edge to someone else's territory).
+// An ownership change touches only the changed territory and its incoming
+// and outgoing edges.
+class FrontierIndex {
+  private:
+    // touching[owner][id]: edges into id from territories of owner
+    std::vector<std::vector<int>> touching;
+    // foreignNeighbors[id]: edges out of id to territories of another owner
+    std::vector<int> foreignNeighbors;
+    std::vector<SparseSet> enemyFrontiers; // [owner]
+    std::vector<SparseSet> ownedFrontiers; // [owner]
+    unsigned long long version = 0; // Store ownership version mirrored
+    bool built = false;
+
+    void addOwnerSlots(const Map &map, int ownerIndex);
+    void updateEnemy(const Map &map, int ownerIndex, int id);
+    void updateOwned(const Map &map, int id);
+
+  public:
+    FrontierIndex() = default;
+
+    void build(const Map &map);
+    void clear();
+    // True while the index mirrors every ownership change in the map's store
+    bool isCurrent(const Map &map) const;
+
+    // Applies a change the store has already recorded
+    void ownerChanged(const Map &map, int id, int previous, int next);
+
+    // Empty for owner slots that hold nothing
+    const SparseSet &getEnemyFrontier(int ownerIndex) const;
+    const SparseSet &getOwnedFrontier(int ownerIndex) const;
+};
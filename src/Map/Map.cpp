@@ -1,83 +1,126 @@
 #include "Map.h"
+#include "Player/Player.h"
+#include "Utils/Log.h"
+#include "Utils/UnionFind.h"
+#include <algorithm>
+#include <chrono>
 #include <iostream>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 //---------------------------Territory-------------------------------
+// A new territory is standalone and owns a single-row store until it is
+// added to a map.
 Territory::Territory(const std::string &name, int posX, int posY)
-    : name(new std::string(name)), x(new int(posX)), y(new int(posY)),
-      armies(new int(0)), player(nullptr) {}
+    : name(new std::string(name)), nameId(-1), store(new TerritoryStore()),
+      map(nullptr), id(-1) {
+    store->add(posX, posY);
+}
+
+// Used by Map::createTerritory, which fills in the name and store row
+Territory::Territory(Map* map, int id)
+    : name(nullptr), nameId(-1), store(&map->store), map(map), id(id) {}
 
 // Destructor to clean up dynamically allocated memory.
+// The name and store are only ours while the territory is standalone.
 Territory::~Territory() {
-    delete name;
-    delete x;
-    delete y;
-    delete armies;
+    if (!map) {
+        delete name;
+        delete store;
+    }
     name = nullptr;
-    x = nullptr;
-    y = nullptr;
-    armies = nullptr;
+    store = nullptr;
 }
 
 // Copy constructor
-Territory::Territory(const Territory &territory2) {
+// The copy is standalone: it is not registered with the original's map.
+Territory::Territory(const Territory &territory2)
+    : nameId(-1), store(new TerritoryStore()), map(nullptr), id(-1) {
     name = new std::string(*(territory2.name));
-    x = new int(*(territory2.x));
-    y = new int(*(territory2.y));
+    store->add(territory2.getX(), territory2.getY());
+    store->setArmies(0, territory2.getArmies());
+    store->setOwner(0, territory2.getPlayer());
     adjacentTerritories = territory2.adjacentTerritories;
-    armies = new int(*(territory2.armies));
 }
 
 // Adds an adjacent territory to the current territory's adjacency list.
+// The owning map's CSR index is stale afterwards and gets rebuilt on demand.
 void Territory::addAdjacentTerritory(Territory* territory) {
     adjacentTerritories.push_back(territory);
+    if (map)
+        map->invalidateAdjacencyIndex();
 }
 
 /*
- ** Getters for name, coordinates, number of armies, and adjacent territories.
+ ** Getters for coordinates, number of armies, and adjacent territories.
  * **
  */
-std::string Territory::getName() const {
-    return *name;
-}
 int Territory::getX() const {
-    return *x;
+    return store->getX(row());
 }
 int Territory::getY() const {
-    return *y;
+    return store->getY(row());
+}
+
+// Served from the owning map's contiguous neighbour array when the territory
+// belongs to a map, otherwise from the territory's own edge list.
+TerritoryView Territory::getAdjacentTerritories() const {
+    if (map)
+        return map->getNeighbors(id);
+    return TerritoryView(adjacentTerritories);
 }
 
-const std::vector<Territory*> &Territory::getAdjacentTerritories() const {
-    return adjacentTerritories;
+bool Territory::isAdjacentTo(const Territory* other) const {
+    if (!other)
+        return false;
+    if (map && other->map == map)
+        return map->areAdjacent(id, other->id);
+    for (Territory* neighbor : getAdjacentTerritories()) {
+        if (neighbor == other)
+            return true;
+    }
+    return false;
 }
 
 Player* Territory::getPlayer() const {
-    return player;
+    return store->getOwner(row());
 }
 
 // Basic setters
+// Territories on a map are renamed through its name table
 void Territory::setName(const std::string &n) {
+    if (map) {
+        map->nameTerritory(this, n);
+        return;
+    }
     delete name;
     name = new std::string(n);
 }
 void Territory::setX(int posX) {
-    delete x;
-    x = new int(posX);
+    store->setX(row(), posX);
+    if (map)
+        map->invalidateSpatialIndex();
 }
 void Territory::setY(int posY) {
-    delete y;
-    y = new int(posY);
+    store->setY(row(), posY);
+    if (map)
+        map->invalidateSpatialIndex();
 }
 
 void Territory::setArmies(int numOfArmies) {
-    delete armies;
-    armies = new int(numOfArmies);
+    store->setArmies(row(), numOfArmies);
 }
 
 void Territory::setPlayer(Player* p) {
-    player = p;
+    if (map)
+        map->setOwner(id, p);
+    else
+        store->setOwner(0, p);
+}
+
+void Territory::setContinentId(int continentId) {
+    store->setContinentId(row(), continentId);
 }
 
 // Assignment Operator
@@ -85,16 +128,14 @@ void Territory::setPlayer(Player* p) {
 Territory &Territory::operator=(const Territory &territory2) {
     if (this == &territory2)
         return *this;
-    delete name;
-    delete x;
-    delete y;
-    delete armies;
-    name = new std::string(*(territory2.name));
-    x = new int(*(territory2.x));
-    y = new int(*(territory2.y));
+    setName(*(territory2.name));
+    setX(territory2.getX());
+    setY(territory2.getY());
     adjacentTerritories = territory2.adjacentTerritories;
-    armies = new int(*(territory2.armies));
-    player = territory2.player;
+    setArmies(territory2.getArmies());
+    setPlayer(territory2.getPlayer());
+    if (map)
+        map->invalidateAdjacencyIndex();
     return *this;
 }
 
@@ -128,8 +169,8 @@ std::ostream &operator<<(std::ostream &os, const Territory &territory) {
 
 // Print territory with adjacent territories labeled by ownership
 void Territory::printWithAdjacencies(std::ostream &os) const {
-    os << name << " (" << *armies;
-    if (*armies == 1)
+    os << *name << " (" << getArmies();
+    if (getArmies() == 1)
         os << " army";
     else
         os << " armies";
@@ -141,7 +182,7 @@ void Territory::printWithAdjacencies(std::ostream &os) const {
         os << " [\n";
         for (const auto &neighbor : neighbors) {
             os << "    " << neighbor->getName();
-            if (neighbor->getPlayer() == player)
+            if (neighbor->getPlayer() == getPlayer())
                 os << " - defend";
             else
                 os << " - attack";
@@ -153,11 +194,12 @@ void Territory::printWithAdjacencies(std::ostream &os) const {
 
 //-------------------------------Continent-----------------------------
 Continent::Continent(const std::string &name, int reinforcementBonus)
-    : name(new std::string(name)),
-      reinforcementBonus(new int(reinforcementBonus)) {}
+    : name(new std::string(name)), nameId(-1),
+      reinforcementBonus(new int(reinforcementBonus)), id(-1) {}
 
 // Copy constructor
-Continent::Continent(const Continent &continent2) {
+// Like territories, the copy is not registered with the original's map.
+Continent::Continent(const Continent &continent2) : nameId(-1), id(-1) {
     name = new std::string(*(continent2.name));
     reinforcementBonus = new int(*(continent2.reinforcementBonus));
     territories = continent2.territories;
@@ -167,15 +209,18 @@ Continent::Continent(const Continent &continent2) {
 // territories vector is not deleted here, will be handled by Map class
 // destructor.
 Continent::~Continent() {
-    delete name;
+    if (nameId < 0)
+        delete name;
     delete reinforcementBonus;
     name = nullptr;
     reinforcementBonus = nullptr;
 }
 
-// Adds a territory to the current continent's territories vector.
+// Adds a territory to the current continent's territories vector and records
+// the membership in the territory's store row.
 void Continent::addTerritory(Territory* territory) {
     territories.push_back(territory);
+    territory->setContinentId(id);
 }
 
 // Basic getters
@@ -185,17 +230,16 @@ const std::vector<Territory*> &Continent::getTerritories() const {
 int Continent::getReinforcementBonus() const {
     return *reinforcementBonus;
 }
-std::string Continent::getName() const {
-    return *name;
-}
 
 // Assignment Operator, handles self-assignment and deep copies the data.
 Continent &Continent::operator=(const Continent &continent2) {
     if (this == &continent2)
         return *this;
-    delete name;
+    if (nameId < 0)
+        delete name;
     delete reinforcementBonus;
     name = new std::string(*(continent2.name));
+    nameId = -1;
     reinforcementBonus = new int(*(continent2.reinforcementBonus));
     territories = continent2.territories;
     return *this;
@@ -247,8 +291,8 @@ Map::~Map() {
     territories.clear();
 }
 
-// Copy constructor for deep copying map properties and references to
-// territories and continents.
+// Copy constructor for deep copying map properties, territories and
+// continents.
 Map::Map(const Map &map2) {
     image = new std::string(*(map2.image));
     scroll = new std::string(*(map2.scroll));
@@ -257,20 +301,165 @@ Map::Map(const Map &map2) {
     wrap = new bool(*(map2.wrap));
     warn = new bool(*(map2.warn));
 
-    territories = map2.territories;
-    continents = map2.continents;
+    copyContents(map2);
+}
+
+Map* Map::cloneTopology() const {
+    Map* clone = new Map(*wrap, *warn, *author, *image, *name, *scroll);
+    clone->reserve(territories.size(), continents.size());
+    for (Continent* continent : continents)
+        clone->addContinent(
+            new Continent(continent->getName(), continent->getBonus()));
+
+    for (Territory* territory : territories) {
+        Territory* copy = clone->createTerritory(
+            territory->getNameView(), territory->getX(), territory->getY());
+        int continentId = territory->getContinentId();
+        if (continentId >= 0)
+            clone->continents[continentId]->addTerritory(copy);
+    }
+
+    if (!adjacencyIndexed)
+        buildAdjacencyIndex();
+    for (size_t i = 0; i < territories.size(); ++i) {
+        std::vector<Territory*> &edges =
+            clone->territories[i]->adjacentTerritories;
+        edges.reserve(adjacencyOffsets[i + 1] - adjacencyOffsets[i]);
+        for (int neighborId : getNeighborIds(static_cast<int>(i)))
+            edges.push_back(clone->territories[neighborId]);
+    }
+    clone->buildAdjacencyIndex();
+    clone->spatial = spatial;
+    return clone;
+}
+
+// Rebuilds other's continents, territories, edges and board state in this
+// (empty) map. The copied territories keep their owners, but they are not
+// added to those players' territory lists.
+void Map::copyContents(const Map &other) {
+    store.reserve(other.territories.size());
+    for (Continent* continent : other.continents)
+        addContinent(new Continent(continent->getName(), continent->getBonus()));
+
+    for (Territory* territory : other.territories) {
+        Territory* copy = new Territory(territory->getName(), territory->getX(),
+                                        territory->getY());
+        addTerritory(copy);
+        store.setArmies(copy->id, territory->getArmies());
+        store.setOwner(copy->id, territory->getPlayer());
+    }
+
+    for (size_t c = 0; c < other.continents.size(); ++c) {
+        for (Territory* territory : other.continents[c]->territories) {
+            if (territory->map == &other)
+                continents[c]->addTerritory(territories[territory->id]);
+        }
+    }
+
+    for (Territory* territory : other.territories) {
+        std::vector<Territory*> &edges =
+            territories[territory->id]->adjacentTerritories;
+        for (Territory* neighbor : territory->adjacentTerritories) {
+            if (neighbor->map == &other)
+                edges.push_back(territories[neighbor->id]);
+        }
+    }
+    invalidateAdjacencyIndex();
 }
 
-// Adds a territory to the map's territories vector.
+// Adds a territory to the map's territories vector and assigns it the next
+// dense ID. The territory's standalone state moves into the map's store.
 void Map::addTerritory(Territory* territory) {
+    int id = store.add(territory->getX(), territory->getY());
+    store.setArmies(id, territory->getArmies());
+    store.setOwner(id, territory->getPlayer());
+    store.setContinentId(id, territory->getContinentId());
+
+    const std::string* oldName = territory->name;
+    territory->id = id;
+    nameTerritory(territory, *oldName);
+    if (!territory->map) {
+        delete oldName;
+        delete territory->store;
+    }
+
+    territory->store = &store;
+    territory->map = this;
     territories.push_back(territory);
+    invalidateAdjacencyIndex();
+    invalidateSpatialIndex();
 }
 
-// Adds a continent to the map's continents vector.
+Territory* Map::createTerritory(std::string_view name, int x, int y) {
+    int id = store.add(x, y);
+    Territory* territory = new Territory(this, id);
+    nameTerritory(territory, name);
+    territories.push_back(territory);
+    invalidateAdjacencyIndex();
+    invalidateSpatialIndex();
+    return territory;
+}
+
+void Map::reserve(size_t territoryCount, size_t continentCount) {
+    territories.reserve(territoryCount);
+    continents.reserve(continentCount);
+    store.reserve(territoryCount);
+    names.reserve(territoryCount + continentCount);
+}
+
+// Points the territory at its interned name and makes it the one found by
+// that name. A rename stops the old name from finding the territory.
+void Map::nameTerritory(Territory* territory, std::string_view name) {
+    int oldSymbol = territory->map == this ? territory->nameId : -1;
+    if (oldSymbol >= 0 && territoryBySymbol[oldSymbol] == territory->id)
+        territoryBySymbol[oldSymbol] = -1;
+    int symbol = names.intern(name);
+    if (territoryBySymbol.size() < names.size())
+        territoryBySymbol.resize(names.size(), -1);
+    territoryBySymbol[symbol] = territory->id;
+    territory->name = &names.get(symbol);
+    territory->nameId = symbol;
+}
+
+// Adds a continent to the map's continents vector, assigns its index and
+// interns its name. Territories the continent already holds take the index.
 void Map::addContinent(Continent* continent) {
+    continent->id = static_cast<int>(continents.size());
+    for (Territory* territory : continent->territories)
+        territory->setContinentId(continent->id);
+
+    int symbol = names.intern(*continent->name);
+    if (continentBySymbol.size() < names.size())
+        continentBySymbol.resize(names.size(), -1);
+    continentBySymbol[symbol] = continent->id;
+    if (continent->nameId < 0)
+        delete continent->name;
+    continent->name = &names.get(symbol);
+    continent->nameId = symbol;
+
     continents.push_back(continent);
 }
 
+Territory* Map::findTerritory(std::string_view name) const {
+    int id = findTerritoryId(name);
+    return id < 0 ? nullptr : territories[id];
+}
+
+int Map::findTerritoryId(std::string_view name) const {
+    int symbol = names.find(name);
+    if (symbol < 0 || symbol >= static_cast<int>(territoryBySymbol.size()))
+        return -1;
+    return territoryBySymbol[symbol];
+}
+
+Continent* Map::findContinent(std::string_view name) const {
+    int symbol = names.find(name);
+    if (symbol < 0 || symbol >= static_cast<int>(continentBySymbol.size()))
+        return nullptr;
+    int id = continentBySymbol[symbol];
+    return id < 0 ? nullptr : continents[id];
+}
+
 // Basic getters
 std::string Map::getImage() const {
     return *image;
@@ -293,6 +482,177 @@ bool Map::getWarn() const {
 const std::vector<Continent*> &Map::getContinents() const {
     return continents;
 }
+const std::vector<Territory*> &Map::getTerritories() const {
+    return territories;
+}
+int Map::getTerritoryCount() const {
+    return static_cast<int>(territories.size());
+}
+Territory* Map::getTerritory(int id) const {
+    return territories[id];
+}
+
+// Flattens every territory's edge list into the CSR arrays. Edges to
+// territories that belong to another map (or to none) cannot be expressed as
+// IDs and are dropped, matching what the loader can produce.
+void Map::buildAdjacencyIndex() const {
+    size_t edgeCount = 0;
+    for (Territory* territory : territories)
+        edgeCount += territory->adjacentTerritories.size();
+
+    adjacencyOffsets.assign(territories.size() + 1, 0);
+    adjacencyIds.clear();
+    adjacencyIds.reserve(edgeCount);
+    adjacencyTerritories.clear();
+    adjacencyTerritories.reserve(edgeCount);
+
+    for (size_t i = 0; i < territories.size(); ++i) {
+        for (Territory* neighbor : territories[i]->adjacentTerritories) {
+            if (neighbor->map != this)
+                continue;
+            adjacencyIds.push_back(neighbor->id);
+            adjacencyTerritories.push_back(neighbor);
+        }
+        adjacencyOffsets[i + 1] = static_cast<int>(adjacencyIds.size());
+    }
+
+    // Counting sort of the edges by target gives the reversed index
+    incomingOffsets.assign(territories.size() + 1, 0);
+    for (int neighborId : adjacencyIds)
+        ++incomingOffsets[neighborId + 1];
+    for (size_t i = 0; i < territories.size(); ++i)
+        incomingOffsets[i + 1] += incomingOffsets[i];
+    incomingIds.resize(adjacencyIds.size());
+    std::vector<int> next(incomingOffsets.begin(), incomingOffsets.end() - 1);
+    for (size_t i = 0; i < territories.size(); ++i) {
+        for (int e = adjacencyOffsets[i]; e < adjacencyOffsets[i + 1]; ++e)
+            incomingIds[next[adjacencyIds[e]]++] = static_cast<int>(i);
+    }
+    adjacencyIndexed = true;
+}
+
+// Distances derive from the adjacency, so they go stale with it
+void Map::invalidateAdjacencyIndex() {
+    adjacencyIndexed = false;
+    enemyDistances.clear();
+    enemyDistanceVersions.clear();
+    frontiers.clear();
+}
+
+TerritoryIdView Map::getNeighborIds(int id) const {
+    if (!adjacencyIndexed)
+        buildAdjacencyIndex();
+    const int* base = adjacencyIds.data();
+    return TerritoryIdView(base + adjacencyOffsets[id],
+                           base + adjacencyOffsets[id + 1]);
+}
+
+TerritoryView Map::getNeighbors(int id) const {
+    if (!adjacencyIndexed)
+        buildAdjacencyIndex();
+    Territory* const* base = adjacencyTerritories.data();
+    return TerritoryView(base + adjacencyOffsets[id],
+                         base + adjacencyOffsets[id + 1]);
+}
+
+TerritoryIdView Map::getIncomingNeighborIds(int id) const {
+    if (!adjacencyIndexed)
+        buildAdjacencyIndex();
+    const int* base = incomingIds.data();
+    return TerritoryIdView(base + incomingOffsets[id],
+                           base + incomingOffsets[id + 1]);
+}
+
+bool Map::areAdjacent(int fromId, int toId) const {
+    for (int neighborId : getNeighborIds(fromId)) {
+        if (neighborId == toId)
+            return true;
+    }
+    return false;
+}
+
+void Map::buildSpatialIndex() const {
+    auto index = std::make_shared<SpatialIndex>();
+    index->build(*this);
+    spatial = index;
+}
+
+void Map::invalidateSpatialIndex() {
+    spatial.reset();
+}
+
+const SpatialIndex &Map::getSpatialIndex() const {
+    if (!spatial)
+        buildSpatialIndex();
+    return *spatial;
+}
+
+std::vector<Territory*>
+Map::getTerritoriesWithinRadius(int x, int y, double radius) const {
+    std::vector<int> ids;
+    getSpatialIndex().withinRadius(x, y, radius, ids);
+    std::vector<Territory*> found;
+    found.reserve(ids.size());
+    for (int id : ids)
+        found.push_back(territories[id]);
+    return found;
+}
+
+std::vector<Territory*>
+Map::getTerritoriesInViewport(int left, int top, int right, int bottom) const {
+    std::vector<int> ids;
+    getSpatialIndex().inRectangle(left, top, right, bottom, ids);
+    std::vector<Territory*> found;
+    found.reserve(ids.size());
+    for (int id : ids)
+        found.push_back(territories[id]);
+    return found;
+}
+
+Territory* Map::findNearestTerritory(int x, int y) const {
+    int id = getSpatialIndex().nearest(x, y);
+    return id >= 0 ? territories[id] : nullptr;
+}
+
+// Multi-source BFS seeded with every territory not held by the owner,
+// walking incoming edges so each territory gets its hops to an enemy
+int Map::distanceToNearestEnemy(const Territory* territory) const {
+    if (!territory || territory->map != this)
+        return Unreachable;
+
+    size_t slot = static_cast<size_t>(store.getOwnerIndex(territory->id) + 1);
+    if (enemyDistances.size() <= slot) {
+        enemyDistances.resize(slot + 1);
+        enemyDistanceVersions.resize(slot + 1, 0);
+    }
+
+    std::vector<int> &field = enemyDistances[slot];
+    if (field.empty()
+        || enemyDistanceVersions[slot] != store.getOwnershipVersion()) {
+        int ownerIndex = static_cast<int>(slot) - 1;
+        int n = getTerritoryCount();
+        std::vector<int> queue;
+        queue.reserve(n);
+        field.assign(n, Unreachable);
+        for (int id = 0; id < n; ++id) {
+            if (store.getOwnerIndex(id) != ownerIndex) {
+                field[id] = 0;
+                queue.push_back(id);
+            }
+        }
+        for (size_t head = 0; head < queue.size(); ++head) {
+            int id = queue[head];
+            for (int neighborId : getIncomingNeighborIds(id)) {
+                if (field[neighborId] == Unreachable) {
+                    field[neighborId] = field[id] + 1;
+                    queue.push_back(neighborId);
+                }
+            }
+        }
+        enemyDistanceVersions[slot] = store.getOwnershipVersion();
+    }
+    return field[territory->id];
+}
 
 // Assignment Operator
 Map &Map::operator=(const Map &map2) {
@@ -310,97 +670,324 @@ Map &Map::operator=(const Map &map2) {
     name = new std::string(*(map2.name));
     wrap = new bool(*(map2.wrap));
     warn = new bool(*(map2.warn));
-    territories = map2.territories;
-    continents = map2.continents;
+
+    for (Territory* territory : territories)
+        delete territory;
+    for (Continent* continent : continents)
+        delete continent;
+    territories.clear();
+    continents.clear();
+    store = TerritoryStore();
+    invalidateSpatialIndex();
+    names = NameTable();
+    territoryBySymbol.clear();
+    continentBySymbol.clear();
+    copyContents(map2);
     return *this;
 }
 
-// Map Validation Methods:
-// Depth-first search to visit territories and build the visited set.
-void Map::depthFirstSearch(Territory* start,
-                           std::unordered_set<Territory*> &visited) const {
-    // Base case: if already visited, return.
-    if (visited.find(start) != visited.end())
-        return;
-    // Mark the current territory as visited.
-    visited.insert(start);
-    for (Territory* adjacent : start->getAdjacentTerritories()) {
-        depthFirstSearch(adjacent, visited);
-    }
+int Map::countTerritoriesOwnedBy(const Player* player) const {
+    return store.countOwnedBy(store.findOwnerIndex(player));
 }
 
-// Checks if all territories in the map are interconnected.
-// Satisfies: 1) the map is a connected graph
-bool Map::isConnectedGraph() const {
-    if (territories.empty())
-        return true;
+int Map::countArmiesOwnedBy(const Player* player) const {
+    int ownerIndex = store.findOwnerIndex(player);
+    return ownerIndex < 0 ? 0 : store.sumArmiesOwnedBy(ownerIndex);
+}
 
-    std::unordered_set<Territory*> visited;
-    depthFirstSearch(territories[0], visited);
+bool Map::controlsContinent(const Player* player,
+                            const Continent* continent) const {
+    return store.ownsAllOf(store.findOwnerIndex(player), continent->getId());
+}
 
-    // If the number of visited territories equals total territories, it's
-    // connected.
-    return visited.size() == territories.size();
+int Map::countTerritoriesOwnedIn(const Player* player,
+                                 const Continent* continent) const {
+    return store.countOwnedIn(store.findOwnerIndex(player), continent->getId());
 }
 
-// Checks if all continents in the map are interconnected through their
-// territories. Satisfies: 2) all continents are connected subgraphs
-bool Map::areContinentsConnected() const {
-    if (continents.empty() || territories.empty())
-        return true;
+// O(#continents): one counter comparison per continent
+std::vector<Continent*>
+Map::getContinentsControlledBy(const Player* player) const {
+    std::vector<Continent*> controlled;
+    int ownerIndex = store.findOwnerIndex(player);
+    for (Continent* continent : continents) {
+        if (store.ownsAllOf(ownerIndex, continent->getId()))
+            controlled.push_back(continent);
+    }
+    return controlled;
+}
+
+bool Map::controlsAllTerritories(const Player* player) const {
+    return player && !territories.empty()
+        && countTerritoriesOwnedBy(player) == getTerritoryCount();
+}
+
+// Keeps the frontier index in step when it mirrors the store; otherwise it
+// is rebuilt by the next query.
+void Map::setOwner(int id, Player* player) {
+    bool tracked = frontiers.isCurrent(*this);
+    int previous = store.getOwnerIndex(id);
+    store.setOwner(id, player);
+    int next = store.getOwnerIndex(id);
+    if (tracked && previous != next)
+        frontiers.ownerChanged(*this, id, previous, next);
+}
+
+std::vector<Territory*> Map::toTerritories(const SparseSet &ids) const {
+    std::vector<Territory*> result;
+    result.reserve(ids.size());
+    for (int id : ids)
+        result.push_back(territories[id]);
+    return result;
+}
+
+std::vector<Territory*> Map::getEnemyFrontier(const Player* player) const {
+    if (!frontiers.isCurrent(*this))
+        frontiers.build(*this);
+    return toTerritories(
+        frontiers.getEnemyFrontier(store.findOwnerIndex(player)));
+}
+
+std::vector<Territory*> Map::getOwnedFrontier(const Player* player) const {
+    if (!frontiers.isCurrent(*this))
+        frontiers.build(*this);
+    return toTerritories(
+        frontiers.getOwnedFrontier(store.findOwnerIndex(player)));
+}
+
+// Captures the board plus each given player's reinforcement pool.
+MapSnapshot Map::takeSnapshot(const std::vector<Player*> &players) const {
+    MapSnapshot snapshot;
+    snapshot.map = this;
+    snapshot.armies = std::make_shared<std::vector<int>>(store.getArmiesColumn());
+    snapshot.owners = std::make_shared<std::vector<int>>(store.getOwnerColumn());
+    snapshot.ownerTable =
+        std::make_shared<std::vector<Player*>>(store.getOwnerTable());
+    snapshot.players = std::make_shared<std::vector<MapSnapshot::PlayerState>>();
+
+    for (Player* player : players) {
+        MapSnapshot::PlayerState state;
+        state.player = player;
+        state.reinforcementPool = player->getReinforcementPool();
+        snapshot.players->push_back(std::move(state));
+    }
+    return snapshot;
+}
+
+// Writes a snapshot's armies, owners and reinforcement pools back onto the
+// board. Territories that change hands move between their players' lists.
+bool Map::restoreSnapshot(const MapSnapshot &snapshot) {
+    if (snapshot.map != this || snapshot.size() != territories.size())
+        return false;
+
+    for (size_t id = 0; id < territories.size(); ++id) {
+        int row = static_cast<int>(id);
+        store.setArmies(row, snapshot.getArmies(row));
+        Player* owner = snapshot.getOwner(row);
+        Player* current = store.getOwner(row);
+        if (owner == current)
+            continue;
+        if (current)
+            current->removeTerritory(territories[id]);
+        if (owner)
+            owner->addTerritory(territories[id]);
+        else
+            territories[id]->setPlayer(nullptr);
+    }
 
-    // Perform DFS from the first territory and see if we can reach at least one
-    // territory in each continent.
-    std::unordered_set<Territory*> visited;
-    depthFirstSearch(territories[0], visited);
+    for (const MapSnapshot::PlayerState &state : *snapshot.players)
+        state.player->setReinforcementPool(state.reinforcementPool);
+    return true;
+}
 
-    // Loops through each continent to check if at least one territory has been
-    // visited. If any continent has no visited territories, return false.
-    for (Continent* continent : continents) {
-        bool continentVisited = false;
+// Map Validation Methods:
+namespace {
+double elapsedMs(std::chrono::steady_clock::time_point since) {
+    return std::chrono::duration<double, std::milli>(
+               std::chrono::steady_clock::now() - since)
+        .count();
+}
+} // namespace
+
+// Iterative breadth-first search over the CSR index. Every territory is
+// enqueued at most once, so the queue is a flat array with a read cursor.
+void Map::markReachable(int start, Bitset &visited) const {
+    std::vector<int> queue;
+    queue.reserve(territories.size());
+    visited.set(start);
+    queue.push_back(start);
+
+    for (size_t head = 0; head < queue.size(); ++head) {
+        for (int adjacent : getNeighborIds(queue[head])) {
+            if (!visited.testAndSet(adjacent))
+                queue.push_back(adjacent);
+        }
+    }
+}
 
-        for (Territory* territory : continent->getTerritories()) {
-            if (visited.find(territory) != visited.end()) {
-                continentVisited = true;
-                break;
-            }
+// Checks that every continent induces a connected subgraph. A single
+// union-find sweep over the CSR edges joins the endpoints of every
+// intra-continent edge; a continent is connected when all of its
+// territories end up under one root. Continents that are split are
+// recorded with their components.
+// Satisfies: 2) all continents are connected subgraphs
+bool Map::areContinentsConnected(
+    std::vector<DisconnectedContinent> &disconnected) const {
+    int territoryCount = static_cast<int>(territories.size());
+    UnionFind sets(territoryCount);
+
+    for (int id = 0; id < territoryCount; ++id) {
+        int continentId = store.getContinentId(id);
+        if (continentId < 0)
+            continue;
+        for (int neighborId : getNeighborIds(id)) {
+            if (store.getContinentId(neighborId) == continentId)
+                sets.unite(id, neighborId);
         }
+    }
 
-        if (!continentVisited)
-            return false;
+    // Each root is one component of its continent
+    std::vector<int> componentCounts(continents.size(), 0);
+    for (int id = 0; id < territoryCount; ++id) {
+        int continentId = store.getContinentId(id);
+        if (continentId >= 0 && sets.find(id) == id)
+            ++componentCounts[continentId];
     }
 
-    return true;
+    bool allConnected = true;
+    for (int count : componentCounts)
+        allConnected = allConnected && count == 1;
+    if (!allConnected)
+        collectSplitContinents(sets, componentCounts, disconnected);
+    return allConnected;
+}
+
+// Lists the components of every continent that does not have exactly one,
+// given a union-find in which only intra-continent edges were joined
+void Map::collectSplitContinents(
+    UnionFind &sets,
+    const std::vector<int> &componentCounts,
+    std::vector<DisconnectedContinent> &disconnected) const {
+    int territoryCount = static_cast<int>(territories.size());
+    std::vector<int> componentOfRoot(territoryCount, -1);
+    for (size_t c = 0; c < continents.size(); ++c) {
+        if (componentCounts[c] == 1)
+            continue;
+
+        DisconnectedContinent split;
+        split.name = continents[c]->getName();
+        for (int id = 0; id < territoryCount; ++id) {
+            if (store.getContinentId(id) != static_cast<int>(c))
+                continue;
+            int root = sets.find(id);
+            if (componentOfRoot[root] < 0) {
+                componentOfRoot[root] =
+                    static_cast<int>(split.components.size());
+                split.components.emplace_back();
+            }
+            split.components[componentOfRoot[root]].push_back(
+                territories[id]->getName());
+        }
+        disconnected.push_back(split);
+    }
+}
+
+// Every territory is reachable from the first one following the edges
+// Satisfies: 1) the map is a connected graph
+bool Map::isConnectedGraph() const {
+    Bitset visited(territories.size());
+    if (!territories.empty())
+        markReachable(0, visited);
+    return visited.all();
 }
 
 // Checks if territories are unique to continents.
 // Satisfies: 3) each country belongs to one and only one continent
 bool Map::isTerritoryInOneContinent() const {
-    std::unordered_set<Territory*> territoriesSet;
+    Bitset assigned(territories.size());
 
     for (Continent* continent : continents) {
         for (Territory* territory : continent->getTerritories()) {
-            if (territoriesSet.find(territory) != territoriesSet.end())
+            if (territory->getMap() != this)
+                continue;
+            if (assigned.testAndSet(territory->getId()))
                 return false;
-            territoriesSet.insert(territory);
         }
     }
     return true;
 }
 
-// Determines the validity of the map.
+// Runs every validation rule once and times each of them.
+ValidationReport Map::validateWithReport() const {
+    using Clock = std::chrono::steady_clock;
+    Clock::time_point start = Clock::now();
+    ValidationReport report;
+
+    // 1) the map is a connected graph
+    Clock::time_point checkStart = Clock::now();
+    report.connectedGraph.passed = isConnectedGraph();
+    report.connectedGraph.elapsedMs = elapsedMs(checkStart);
+
+    // 2) all continents are connected subgraphs
+    checkStart = Clock::now();
+    report.continentsConnected.passed =
+        areContinentsConnected(report.disconnectedContinents);
+    report.continentsConnected.elapsedMs = elapsedMs(checkStart);
+
+    // 3) each territory belongs to one and only one continent
+    checkStart = Clock::now();
+    report.territoriesInOneContinent.passed = isTerritoryInOneContinent();
+    report.territoriesInOneContinent.elapsedMs = elapsedMs(checkStart);
+
+    report.territoryCount = territories.size();
+    report.totalMs = elapsedMs(start);
+    return report;
+}
+
+// Determines the validity of the map and prints the report.
 bool Map::validate() const {
-    // std::cout << isConnected() << " " << areContinentsInterconnected() << " "
-    // << areTerritoriesUniqueToContinents() << " these were results\n";
-    std::cout << "VALIDATION RESULTS:\n"
-              << "1) The map is a connected graph: "
-              << (isConnectedGraph() ? "true" : "false") << "\n"
-              << "2) All continents are connected subgraphs: "
-              << (areContinentsConnected() ? "true" : "false") << "\n"
-              << "3) Each territory belongs to one and only one continent: "
-              << (isTerritoryInOneContinent() ? "true" : "false") << "\n";
-    return isConnectedGraph() && areContinentsConnected()
-        && isTerritoryInOneContinent();
+    ValidationReport report = validateWithReport();
+    LOG_INFO << report;
+    return report.isValid();
+}
+
+//---------------------------ValidationReport----------------------------
+bool ValidationReport::isValid() const {
+    return connectedGraph.passed && continentsConnected.passed
+        && territoriesInOneContinent.passed;
+}
+
+std::ostream &operator<<(std::ostream &os, const ValidationReport &report) {
+    os << "VALIDATION RESULTS:\n"
+       << "1) The map is a connected graph: "
+       << (report.connectedGraph.passed ? "true" : "false") << "\n"
+       << "2) All continents are connected subgraphs: "
+       << (report.continentsConnected.passed ? "true" : "false") << "\n";
+
+    // List the pieces of every split continent, a few names per piece
+    const size_t namesShown = 5;
+    for (const DisconnectedContinent &split : report.disconnectedContinents) {
+        os << "   - " << split.name << " has " << split.components.size()
+           << " components:";
+        for (const auto &component : split.components) {
+            os << " [";
+            for (size_t i = 0; i < component.size() && i < namesShown; ++i)
+                os << (i ? ", " : "") << component[i];
+            if (component.size() > namesShown)
+                os << ", +" << component.size() - namesShown << " more";
+            os << "]";
+        }
+        os << "\n";
+    }
+
+    os
+       << "3) Each territory belongs to one and only one continent: "
+       << (report.territoriesInOneContinent.passed ? "true" : "false") << "\n"
+       << "Validated " << report.territoryCount << " territories in "
+       << report.totalMs << " ms (" << report.connectedGraph.elapsedMs
+       << " / " << report.continentsConnected.elapsedMs << " / "
+       << report.territoriesInOneContinent.elapsedMs << ")\n";
+    return os;
 }
 
 // Stream insertion Operator
@@ -1,7 +1,15 @@
 #pragma once
+#include "FrontierIndex.h"
+#include "SpatialIndex.h"
+#include "MapSnapshot.h"
+#include "NameTable.h"
+#include "TerritoryStore.h"
+#include "Utils/Bitset.h"
+#include <algorithm>
 #include <memory>
 #include <set>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -13,15 +21,52 @@ class Player;
 class Territory;
 class Continent;
 class Map;
+class UnionFind;
+
+// Read-only view over a contiguous run of elements owned elsewhere
+template <typename T> class ArrayView {
+  private:
+    const T* first;
+    const T* last;
+
+  public:
+    ArrayView() : first(nullptr), last(nullptr) {}
+    ArrayView(const T* first, const T* last) : first(first), last(last) {}
+    ArrayView(const std::vector<T> &v)
+        : first(v.data()), last(v.data() + v.size()) {}
+
+    const T* begin() const { return first; }
+    const T* end() const { return last; }
+    size_t size() const { return static_cast<size_t>(last - first); }
+    bool empty() const { return first == last; }
+    const T &operator[](size_t i) const { return first[i]; }
+};
+
+typedef ArrayView<Territory*> TerritoryView;
+typedef ArrayView<int> TerritoryIdView;
 
 // Representation of a territory on the map
+// A territory is a lightweight handle: its armies, owner, coordinates and
+// continent live in a row of a TerritoryStore. Territories added to a map use
+// the map's store and name table; standalone territories keep a private
+// single-row store and their own copy of the name.
 class Territory {
   private:
-    std::string* name;
-    IntPtr x, y; // Coordinates on the map
-    IntPtr armies;
-    std::vector<Territory*> adjacentTerritories;
-    Player* player;
+    const std::string* name; // Owned only while standalone
+    int nameId;              // Symbol in the owning map's name table, or -1
+    TerritoryStore* store;
+    std::vector<Territory*> adjacentTerritories; // Edges as added (builder)
+    Map* map; // Owning map, nullptr for standalone territories
+    int id;   // Dense index into the owning map, -1 if standalone
+
+    int row() const { return map ? id : 0; }
+    void setContinentId(int continentId);
+
+    // Territory created directly in a map's store, see Map::createTerritory
+    Territory(Map* map, int id);
+
+    friend class Map;
+    friend class Continent;
 
   public:
     Territory(const std::string &name, int x, int y);
@@ -30,17 +75,30 @@ class Territory {
     ~Territory();
 
     // Getters
-    std::string getName() const;
+    const std::string &getName() const { return *name; }
+    std::string_view getNameView() const { return *name; }
+    int getNameId() const { return nameId; }
 
     int getX() const;
 
     int getY() const;
 
-    int getArmies() const { return *armies; }
-    void addArmies(int amount) { *armies += amount; }
-    void removeArmies(int amount) { *armies = std::max(0, *armies - amount); }
+    int getArmies() const { return store->getArmies(row()); }
+    void addArmies(int amount) { store->addArmies(row(), amount); }
+    void removeArmies(int amount) {
+        store->setArmies(row(), std::max(0, getArmies() - amount));
+    }
+
+    // Index of the continent in the owning map, -1 if none
+    int getContinentId() const { return store->getContinentId(row()); }
+
+    // Dense territory ID assigned by the owning map (-1 if standalone)
+    int getId() const { return id; }
+    Map* getMap() const { return map; }
 
-    const std::vector<Territory*> &getAdjacentTerritories() const;
+    // Neighbours, served from the owning map's CSR index when available
+    TerritoryView getAdjacentTerritories() const;
+    bool isAdjacentTo(const Territory* other) const;
     Player* getPlayer() const;
 
     // Setters
@@ -66,9 +124,13 @@ class Territory {
 // Representation of a continent (has territories) on the map
 class Continent {
   private:
-    std::string* name;
+    const std::string* name; // Owned until added to a map, then interned
+    int nameId;
     IntPtr reinforcementBonus;
     std::vector<Territory*> territories;
+    int id; // Index in the owning map, -1 until added to a map
+
+    friend class Map;
 
   public:
     Continent(const std::string &name, int bonus);
@@ -82,12 +144,42 @@ class Continent {
     const std::vector<Territory*> &getTerritories() const;
     int getReinforcementBonus() const;
     int getBonus() const { return *reinforcementBonus; }
-    std::string getName() const;
+    const std::string &getName() const { return *name; }
+    std::string_view getNameView() const { return *name; }
+    int getNameId() const { return nameId; }
+    int getId() const { return id; }
 
     friend std::ostream &operator<<(std::ostream &os,
                                     const Continent &continent);
 };
 
+// Outcome and cost of a single map validation rule
+struct ValidationCheck {
+    bool passed = false;
+    double elapsedMs = 0.0;
+};
+
+// A continent whose territories do not form one connected subgraph
+struct DisconnectedContinent {
+    std::string name;
+    std::vector<std::vector<std::string>> components; // Territory names
+};
+
+// Structured result of Map::validateWithReport()
+struct ValidationReport {
+    ValidationCheck connectedGraph;
+    ValidationCheck continentsConnected;
+    ValidationCheck territoriesInOneContinent;
+    std::vector<DisconnectedContinent> disconnectedContinents;
+    size_t territoryCount = 0;
+    double totalMs = 0.0;
+
+    bool isValid() const;
+
+    friend std::ostream &operator<<(std::ostream &os,
+                                    const ValidationReport &report);
+};
+
 // Representation of the entire map (has continents)
 class Map {
   private:
@@ -99,14 +191,56 @@ class Map {
     std::string* scroll;
     std::vector<Territory*> territories;
     std::vector<Continent*> continents;
+    TerritoryStore store; // Per-territory state, one row per territory ID
 
-    void depthFirstSearch(Territory* start,
-                          std::unordered_set<Territory*> &visited) const;
-    bool isConnectedGraph() const;
-    bool areContinentsConnected() const;
+    // Territory and continent names, stored once. The symbol -> ID tables
+    // give O(1) lookup by name; on duplicates the last one added wins.
+    NameTable names;
+    std::vector<int> territoryBySymbol;
+    std::vector<int> continentBySymbol;
+
+    // Compressed sparse row adjacency over dense territory IDs: the
+    // neighbours of territory i are adjacencyIds[offsets[i]..offsets[i+1]).
+    // adjacencyTerritories mirrors adjacencyIds as pointers so the pointer
+    // API can hand out views without allocating. Rebuilt lazily whenever
+    // territories or edges are added.
+    mutable std::vector<int> adjacencyOffsets;
+    mutable std::vector<int> adjacencyIds;
+    mutable std::vector<Territory*> adjacencyTerritories;
+    // The same edges reversed: territories listing i as a neighbour
+    mutable std::vector<int> incomingOffsets;
+    mutable std::vector<int> incomingIds;
+    mutable bool adjacencyIndexed = false;
+
+    // Per owner table slot + 1 (slot 0 = unowned), every territory's hops
+    // to the nearest territory of another owner; a field is recomputed
+    // when the store's ownership version moves on.
+    mutable std::vector<std::vector<int>> enemyDistances;
+    mutable std::vector<unsigned long long> enemyDistanceVersions;
+
+    // Per-owner frontiers, built on first query and then updated on every
+    // ownership change made through Territory::setPlayer
+    mutable FrontierIndex frontiers;
+
+    // Grid over territory coordinates, built on demand or eagerly via
+    // buildSpatialIndex(), dropped when territories are added or moved.
+    // Shared with topology clones.
+    mutable std::shared_ptr<const SpatialIndex> spatial;
+
+    void nameTerritory(Territory* territory, std::string_view name);
+    void copyContents(const Map &other);
+    void setOwner(int id, Player* player);
+    std::vector<Territory*> toTerritories(const SparseSet &ids) const;
+    friend class Territory;
+
+    void markReachable(int start, Bitset &visited) const;
+    bool areContinentsConnected(
+        std::vector<DisconnectedContinent> &disconnected) const;
     bool isTerritoryInOneContinent() const;
 
   public:
+    static constexpr int Unreachable = -1; // Distance with no path
+
     Map(const Map &other); // Copy constructor
     Map(bool wrap,
         bool warn,
@@ -117,6 +251,11 @@ class Map {
     Map &operator=(const Map &other); // Assignment operator
     ~Map();
 
+    // New map with the same details, continents, territories and edges but
+    // an empty board (no owners, no armies). Cheaper than a copy, and the
+    // clone shares this map's spatial index instead of rebuilding it.
+    Map* cloneTopology() const;
+
     // Getters
     bool getWrap() const;
     bool getWarn() const;
@@ -125,11 +264,88 @@ class Map {
     std::string getName() const;
     std::string getScroll() const;
     const std::vector<Continent*> &getContinents() const;
+    const std::vector<Territory*> &getTerritories() const;
+    int getTerritoryCount() const;
+    Territory* getTerritory(int id) const;
+    TerritoryStore &getStore() { return store; }
+    const TerritoryStore &getStore() const { return store; }
 
     void addTerritory(Territory* territory);
     void addContinent(Continent* continent);
+    // Same as addTerritory(new Territory(name, x, y)) without building the
+    // standalone territory first
+    Territory* createTerritory(std::string_view name, int x, int y);
+    // Preallocates room for the given number of territories and continents
+    void reserve(size_t territoryCount, size_t continentCount);
+
+    // Name lookup through the interning table, nullptr if unknown
+    Territory* findTerritory(std::string_view name) const;
+    int findTerritoryId(std::string_view name) const; // -1 if unknown
+    Continent* findContinent(std::string_view name) const;
+    const NameTable &getNames() const { return names; }
+
+    // CSR adjacency index
+    void buildAdjacencyIndex() const;
+    void invalidateAdjacencyIndex();
+    bool isAdjacencyIndexed() const { return adjacencyIndexed; }
+    TerritoryIdView getNeighborIds(int id) const;
+    TerritoryView getNeighbors(int id) const;
+    TerritoryIdView getIncomingNeighborIds(int id) const;
+    bool areAdjacent(int fromId, int toId) const;
+
+    // Hops to the nearest territory held by anyone else (or nobody),
+    // Unreachable if there is none. O(1) while ownership is unchanged; the
+    // first query after a change costs one BFS over the map.
+    int distanceToNearestEnemy(const Territory* territory) const;
+
+    // Coordinate queries through the spatial index, sublinear on maps whose
+    // territories are spread out: territories within radius of a point,
+    // inside a viewport rectangle (boundaries included), and the one
+    // closest to a point (nullptr on an empty map)
+    void buildSpatialIndex() const;
+    void invalidateSpatialIndex();
+    const SpatialIndex &getSpatialIndex() const;
+    std::vector<Territory*>
+    getTerritoriesWithinRadius(int x, int y, double radius) const;
+    std::vector<Territory*>
+    getTerritoriesInViewport(int left, int top, int right, int bottom) const;
+    Territory* findNearestTerritory(int x, int y) const;
+
+    // Ownership queries backed by the store's bitsets and counters
+    int countTerritoriesOwnedBy(const Player* player) const;
+    int countArmiesOwnedBy(const Player* player) const;
+    int countTerritoriesOwnedIn(const Player* player,
+                                const Continent* continent) const;
+    bool controlsContinent(const Player* player,
+                           const Continent* continent) const;
+    std::vector<Continent*>
+    getContinentsControlledBy(const Player* player) const;
+    bool controlsAllTerritories(const Player* player) const;
+
+    // Frontier queries, O(frontier size) once the index is built:
+    // territories of other owners that the player's territories border, and
+    // the player's territories that border another owner
+    std::vector<Territory*> getEnemyFrontier(const Player* player) const;
+    std::vector<Territory*> getOwnedFrontier(const Player* player) const;
+
+    // Board snapshots for simulation. Capturing costs one copy of the armies
+    // and owner columns; forks of a snapshot share them until written.
+    // Restoring returns false, changing nothing, if the snapshot was taken
+    // from another map.
+    MapSnapshot
+    takeSnapshot(const std::vector<Player*> &players = {}) const;
+    bool restoreSnapshot(const MapSnapshot &snapshot);
 
     bool validate() const;
+    ValidationReport validateWithReport() const;
+    // Rule 1 alone: every territory is reachable from the first
+    bool isConnectedGraph() const;
+    // Fills in the components of each continent whose count is not 1, from
+    // a union-find over intra-continent edges (see StreamingValidator)
+    void collectSplitContinents(
+        UnionFind &sets,
+        const std::vector<int> &componentCounts,
+        std::vector<DisconnectedContinent> &disconnected) const;
 
     friend std::ostream &operator<<(std::ostream &os, const Map &map);
 };
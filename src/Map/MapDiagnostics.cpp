@@ -0,0 +1,43 @@
+#include "MapDiagnostics.h"
+
+#include <utility>
+
+std::ostream &operator<<(std::ostream &os, const MapDiagnostic &diagnostic) {
+    if (diagnostic.line != 0)
+        os << "line " << diagnostic.line << ": ";
+    os << (diagnostic.severity == MapDiagnostic::Severity::Error
+               ? "**ERROR**: "
+               : "**WARNING**: ")
+       << diagnostic.message;
+    return os;
+}
+
+void MapDiagnostics::add(MapDiagnostic::Severity severity,
+                         MapDiagnostic::Kind kind,
+                         size_t line,
+                         std::string message) {
+    entries.push_back({severity, kind, line, std::move(message)});
+    if (severity == MapDiagnostic::Severity::Error)
+        ++errors;
+}
+
+void MapDiagnostics::clear() {
+    entries.clear();
+    errors = 0;
+}
+
+size_t MapDiagnostics::count(MapDiagnostic::Kind kind) const {
+    size_t total = 0;
+    for (const MapDiagnostic &diagnostic : entries) {
+        if (diagnostic.kind == kind)
+            ++total;
+    }
+    return total;
+}
+
+std::ostream &operator<<(std::ostream &os,
+                         const MapDiagnostics &diagnostics) {
+    for (const MapDiagnostic &diagnostic : diagnostics.entries)
+        os << diagnostic << std::endl;
+    return os;
+}
@@ -0,0 +1,54 @@
+#pragma once
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// One problem found while loading a map file
+struct MapDiagnostic {
+    enum class Severity { Warning, Error };
+    enum class Kind {
+        FileNotFound,
+        MalformedContinent,  // [Continents] line without "name=bonus"
+        InvalidCoordinates,  // Territory x or y is not a number
+        UnknownContinent,    // Territory names a continent that isn't listed
+        DuplicateTerritory,  // A later territory reuses an earlier name
+        UnresolvedAdjacency, // Neighbour name matches no territory
+    };
+
+    Severity severity;
+    Kind kind;
+    size_t line; // 1-based line in the source file, 0 if not tied to a line
+    std::string message;
+
+    friend std::ostream &operator<<(std::ostream &os,
+                                    const MapDiagnostic &diagnostic);
+};
+
+// Errors and warnings collected by MapLoader, in the order they were found.
+// Maps with errors still load; the caller decides what to report.
+class MapDiagnostics {
+  private:
+    std::vector<MapDiagnostic> entries;
+    size_t errors = 0;
+
+  public:
+    void add(MapDiagnostic::Severity severity,
+             MapDiagnostic::Kind kind,
+             size_t line,
+             std::string message);
+    void clear();
+
+    const std::vector<MapDiagnostic> &getEntries() const { return entries; }
+    size_t errorCount() const { return errors; }
+    size_t warningCount() const { return entries.size() - errors; }
+    bool hasErrors() const { return errors != 0; }
+    bool empty() const { return entries.empty(); }
+
+    // Number of entries of the given kind
+    size_t count(MapDiagnostic::Kind kind) const;
+
+    // One line per entry
+    friend std::ostream &operator<<(std::ostream &os,
+                                    const MapDiagnostics &diagnostics);
+};
@@ -1,39 +1,115 @@
 #include "MapDriver.h"
+#include "CompiledMap.h"
 #include "Map.h"
 #include "MapLoader.h"
+#include "Player/Player.h"
+#include "PlayerStrategies/PlayerStrategies.h"
 #include "Utils/Utils.h"
+#include <algorithm>
+#include <cstdint>
 #include <filesystem>
 #include <iostream>
 #include <vector>
 
+namespace {
+// A fixture and the result each validation rule should give on it
+struct MapFixture {
+    std::string file;
+    bool connectedGraph;
+    bool continentsConnected;
+    bool territoriesInOneContinent;
+};
+
+bool checkFixture(const MapFixture &fixture, const ValidationReport &report) {
+    bool matches =
+        report.connectedGraph.passed == fixture.connectedGraph
+        && report.continentsConnected.passed == fixture.continentsConnected
+        && report.territoriesInOneContinent.passed
+               == fixture.territoriesInOneContinent;
+    if (matches)
+        std::cout << "Validation gave the expected result." << std::endl;
+    else
+        std::cout << "**ERROR**: Expected rules 1-3 to give "
+                  << fixture.connectedGraph << fixture.continentsConnected
+                  << fixture.territoriesInOneContinent << std::endl;
+    return matches;
+}
+// Same details, continents, territories and edges, in the same order
+bool sameMap(const Map &a, const Map &b) {
+    if (a.getAuthor() != b.getAuthor() || a.getWrap() != b.getWrap()
+        || a.getContinents().size() != b.getContinents().size()
+        || a.getTerritoryCount() != b.getTerritoryCount())
+        return false;
+    for (size_t i = 0; i < a.getContinents().size(); ++i) {
+        const Continent* x = a.getContinents()[i];
+        const Continent* y = b.getContinents()[i];
+        if (x->getName() != y->getName() || x->getBonus() != y->getBonus())
+            return false;
+    }
+    for (int id = 0; id < a.getTerritoryCount(); ++id) {
+        const Territory* x = a.getTerritories()[id];
+        const Territory* y = b.getTerritories()[id];
+        if (x->getName() != y->getName() || x->getX() != y->getX()
+            || x->getY() != y->getY()
+            || x->getContinentId() != y->getContinentId())
+            return false;
+        TerritoryIdView xs = a.getNeighborIds(id);
+        TerritoryIdView ys = b.getNeighborIds(id);
+        if (!std::equal(xs.begin(), xs.end(), ys.begin(), ys.end()))
+            return false;
+    }
+    return true;
+}
+
+void reportCheck(bool passed, const std::string &what) {
+    std::cout << (passed ? "" : "**ERROR**: ") << what << ": "
+              << (passed ? "yes" : "no") << std::endl;
+}
+
+// Sorted IDs of territories, to compare query results as sets
+std::vector<int> sortedIds(const std::vector<Territory*> &territories) {
+    std::vector<int> ids;
+    ids.reserve(territories.size());
+    for (const Territory* territory : territories)
+        ids.push_back(territory->getId());
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+int64_t squaredDistance(const Territory* territory, int x, int y) {
+    int64_t dx = static_cast<int64_t>(territory->getX()) - x;
+    int64_t dy = static_cast<int64_t>(territory->getY()) - y;
+    return dx * dx + dy * dy;
+}
+} // namespace
+
 void testLoadMaps() {
     std::cout << "\n=== Testing Map Loading and Validation ===\n" << std::endl;
 
-    // Get the current working directory and construct paths
-    std::filesystem::path currentPath = std::filesystem::current_path();
-    std::filesystem::path worldMap = currentPath / "res" / "World.map";
-    std::filesystem::path invalidMap = currentPath / "res" / "invalid.map";
-    std::filesystem::path disconnectedGraph =
-        currentPath / "res" / "disconnected_graph.map";
-    std::filesystem::path disconnectedContinent =
-        currentPath / "res" / "disconnected_continent.map";
-
-    std::vector<std::string> mapFiles = {
-        worldMap.string(),
-        invalidMap.string(),
-        disconnectedGraph.string(),
-        disconnectedContinent.string(),
+    // Get the current working directory and construct paths. Every fixture
+    // but World breaks some rule: invalid has an unreachable territory,
+    // disconnected_graph two separate islands, and disconnected_continent
+    // a continent whose parts only meet through another continent.
+    std::filesystem::path resPath = std::filesystem::current_path() / "res";
+    std::vector<MapFixture> fixtures = {
+        {"World.map", true, true, true},
+        {"invalid.map", false, true, true},
+        {"disconnected_graph.map", false, true, true},
+        {"disconnected_continent.map", true, false, true},
     };
 
     std::vector<Map*> loadedValidMaps;
+    size_t mismatches = 0;
 
-    for (int i = 0; i < mapFiles.size(); i++) {
-        MapLoader loader(mapFiles[i]);
+    for (const MapFixture &fixture : fixtures) {
+        std::string mapFile = (resPath / fixture.file).string();
+        MapLoader loader(mapFile);
         Map* map = loader.loadMap();
         if (!map) {
             std::cout << SEPARATOR_LINE << std::endl;
-            std::cerr << "Failed to load map from file: " << mapFiles[i]
+            std::cerr << "Failed to load map from file: " << mapFile
                       << std::endl;
+            ++mismatches;
             continue;
         }
 
@@ -46,6 +122,9 @@ void testLoadMaps() {
                   << std::endl
                   << "Scroll: " << map->getScroll() << std::endl;
 
+        if (!checkFixture(fixture, map->validateWithReport()))
+            ++mismatches;
+
         if (map->validate()) {
             loadedValidMaps.push_back(map);
             std::cout << "Map is valid." << std::endl
@@ -57,4 +136,209 @@ void testLoadMaps() {
             continue;
         }
     }
-}
\ No newline at end of file
+    std::cout << (fixtures.size() - mismatches) << " of " << fixtures.size()
+              << " fixtures validated as expected." << std::endl;
+
+    if (!loadedValidMaps.empty())
+        testBoardQueries(loadedValidMaps.front());
+    if (!loadedValidMaps.empty())
+        testSpatialQueries(loadedValidMaps.front());
+    testCompiledMapCache((resPath / "World.map").string());
+    for (Map* map : loadedValidMaps)
+        delete map;
+}
+
+void testBoardQueries(Map* map) {
+    std::cout << "\n=== Testing Board Queries on " << map->getName()
+              << " ===\n"
+              << std::endl;
+
+    // Deal the territories out in turn, with as many armies as their index
+    Player* first = new Player("First");
+    Player* second = new Player("Second");
+    const std::vector<Territory*> &territories = map->getTerritories();
+    for (size_t i = 0; i < territories.size(); ++i) {
+        (i % 2 == 0 ? first : second)->addTerritory(territories[i]);
+        territories[i]->setArmies(static_cast<int>(i));
+    }
+
+    for (Player* player : {first, second}) {
+        std::cout << player->getName() << " holds "
+                  << map->countTerritoriesOwnedBy(player) << " territories, "
+                  << map->countArmiesOwnedBy(player) << " armies and "
+                  << map->getOwnedFrontier(player).size()
+                  << " frontier territories" << std::endl;
+    }
+    for (Continent* continent : map->getContinents()) {
+        std::cout << "  " << continent->getName() << ": "
+                  << map->countTerritoriesOwnedIn(first, continent) << " / "
+                  << map->countTerritoriesOwnedIn(second, continent)
+                  << std::endl;
+    }
+
+    // Hand the second player's territories over, then roll the board back
+    MapSnapshot snapshot = map->takeSnapshot({first, second});
+    int firstArmies = map->countArmiesOwnedBy(first);
+    for (Territory* territory :
+         std::vector<Territory*>(second->getTerritories())) {
+        second->removeTerritory(territory);
+        first->addTerritory(territory);
+        territory->setArmies(1);
+    }
+    std::cout << "After the handover, " << first->getName() << " controls "
+              << map->getContinentsControlledBy(first).size() << " of "
+              << map->getContinents().size() << " continents" << std::endl;
+
+    bool restored = map->restoreSnapshot(snapshot)
+        && map->countArmiesOwnedBy(first) == firstArmies
+        && map->countTerritoriesOwnedBy(second)
+               == static_cast<int>(territories.size() / 2);
+    std::cout << (restored ? "Snapshot restored the board."
+                           : "**ERROR**: Snapshot did not restore the board.")
+              << std::endl
+              << SEPARATOR_LINE << std::endl;
+
+    for (Territory* territory : territories)
+        territory->setPlayer(nullptr);
+    for (Player* player : {first, second}) {
+        delete player->getStrategy();
+        delete player;
+    }
+}
+
+void testSpatialQueries(Map* map) {
+    std::cout << "\n=== Testing Spatial Queries on " << map->getName()
+              << " ===\n"
+              << std::endl;
+
+    const std::vector<Territory*> &territories = map->getTerritories();
+    if (territories.empty())
+        return;
+    int minX = territories.front()->getX();
+    int maxX = minX;
+    int minY = territories.front()->getY();
+    int maxY = minY;
+    for (const Territory* territory : territories) {
+        minX = std::min(minX, territory->getX());
+        maxX = std::max(maxX, territory->getX());
+        minY = std::min(minY, territory->getY());
+        maxY = std::max(maxY, territory->getY());
+    }
+
+    // Probe a grid that overhangs the map, so points outside the bounding
+    // box and rectangles clipped by it are covered too
+    const int steps = 8;
+    int spanX = std::max(1, maxX - minX);
+    int spanY = std::max(1, maxY - minY);
+    std::vector<double> radii = {0.0, spanX / 16.0, spanX / 4.0, spanX * 2.0};
+    size_t queries = 0;
+    size_t radiusMismatches = 0;
+    size_t viewportMismatches = 0;
+    size_t nearestMismatches = 0;
+    for (int i = -1; i <= steps + 1; ++i) {
+        for (int j = -1; j <= steps + 1; ++j) {
+            int x = minX + spanX * i / steps;
+            int y = minY + spanY * j / steps;
+
+            for (double radius : radii) {
+                std::vector<Territory*> expected;
+                for (Territory* territory : territories) {
+                    if (squaredDistance(territory, x, y) <= radius * radius)
+                        expected.push_back(territory);
+                }
+                if (sortedIds(map->getTerritoriesWithinRadius(x, y, radius))
+                    != sortedIds(expected))
+                    ++radiusMismatches;
+                ++queries;
+            }
+
+            // A viewport from this point to the one a quarter map away
+            int right = x + spanX / 4;
+            int bottom = y + spanY / 4;
+            std::vector<Territory*> expected;
+            for (Territory* territory : territories) {
+                if (territory->getX() >= x && territory->getX() <= right
+                    && territory->getY() >= y && territory->getY() <= bottom)
+                    expected.push_back(territory);
+            }
+            if (sortedIds(map->getTerritoriesInViewport(x, y, right, bottom))
+                != sortedIds(expected))
+                ++viewportMismatches;
+
+            // Ties may pick another territory, so compare distances
+            int64_t closest = squaredDistance(territories.front(), x, y);
+            for (const Territory* territory : territories)
+                closest = std::min(closest, squaredDistance(territory, x, y));
+            Territory* nearest = map->findNearestTerritory(x, y);
+            if (!nearest || squaredDistance(nearest, x, y) != closest)
+                ++nearestMismatches;
+            queries += 2;
+        }
+    }
+
+    std::cout << queries << " queries checked against a linear scan"
+              << std::endl;
+    reportCheck(radiusMismatches == 0, "Radius queries match");
+    reportCheck(viewportMismatches == 0, "Viewport queries match");
+    reportCheck(nearestMismatches == 0, "Nearest territory queries match");
+    std::cout << SEPARATOR_LINE << std::endl;
+}
+
+void testCompiledMapCache(const std::string &mapFile) {
+    std::cout << "\n=== Testing the Compiled Map Cache ===\n" << std::endl;
+
+    // Work on a copy so the checks never touch the cache next to the
+    // fixture
+    std::filesystem::path directory =
+        std::filesystem::temp_directory_path() / "warzone_cache_check";
+    std::filesystem::create_directories(directory);
+    std::string source = (directory / "World.map").string();
+    std::string cachePath = CompiledMap::cachePathFor(source);
+    std::filesystem::copy_file(
+        mapFile, source, std::filesystem::copy_options::overwrite_existing);
+    std::filesystem::remove(cachePath);
+
+    MapLoader parser(source);
+    parser.setUseCache(false);
+    parser.setVerbose(false);
+    Map* parsed = parser.loadMap();
+    if (!parsed) {
+        std::cout << "**ERROR**: Could not parse " << source << std::endl;
+        return;
+    }
+
+    // The first cached load parses the text and writes the cache
+    MapLoader loader(source);
+    loader.setVerbose(false);
+    Map* compiled = loader.loadMap();
+    reportCheck(compiled && std::filesystem::exists(cachePath),
+                "Loading wrote " + cachePath);
+    delete compiled;
+
+    uint64_t hash = loader.getSourceHash();
+    uint64_t size = std::filesystem::file_size(source);
+    std::string worldName = source.substr(0, source.size() - 4);
+    Map* cached = CompiledMap::read(cachePath, hash, size, worldName);
+    reportCheck(cached && sameMap(*parsed, *cached),
+                "The cache rebuilds the parsed map");
+    delete cached;
+
+    // A cache cut short must be rejected and the text parsed again
+    std::filesystem::resize_file(cachePath,
+                                 std::filesystem::file_size(cachePath) / 2);
+    Map* truncated = CompiledMap::read(cachePath, hash, size, worldName);
+    reportCheck(!truncated, "A truncated cache is rejected");
+    delete truncated;
+    Map* fallback = loader.loadMap();
+    reportCheck(fallback && sameMap(*parsed, *fallback),
+                "Loading falls back to the text");
+    delete fallback;
+    cached = CompiledMap::read(cachePath, hash, size, worldName);
+    reportCheck(cached && sameMap(*parsed, *cached),
+                "The fallback rewrote the cache");
+    delete cached;
+
+    delete parsed;
+    std::filesystem::remove_all(directory);
+    std::cout << SEPARATOR_LINE << std::endl;
+}
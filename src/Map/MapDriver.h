@@ -1,3 +1,16 @@
 #pragma once
+#include <string>
 
-void testLoadMaps();
\ No newline at end of file
+// Forward declarations
+class Map;
+
+void testLoadMaps();
+// Ownership, army and frontier queries and a snapshot round trip on a
+// loaded map, whose territories are left unowned afterwards
+void testBoardQueries(Map* map);
+// Radius, viewport and nearest-territory queries through the spatial index
+// compared with a linear scan over the map's territories
+void testSpatialQueries(Map* map);
+// Round trip through the .wzm cache of a copy of mapFile, then the
+// fallback to the text when the cache is corrupt
+void testCompiledMapCache(const std::string &mapFile);
\ No newline at end of file
@@ -1,34 +1,136 @@
 #include "MapLoader.h"
 
 #include <algorithm>
-#include <fstream>
+#include <cctype>
+#include <charconv>
 #include <iostream>
-#include <sstream>
-#include <unordered_map>
-
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "CompiledMap.h"
+#include "StreamingValidator.h"
+#include "Utils/Log.h"
+#include "Utils/MappedFile.h"
+#include "Utils/ThreadPool.h"
 #include "Utils/Utils.h"
 
-// ---------- trim helpers -----------------
+// ---------- tokenizing helpers -----------------
+// All tokens are views into the mapped file; nothing is copied until a name
+// is interned by the map.
 namespace {
-std::string ltrim(std::string s) {
-    s.erase(s.begin(), std::find_if(s.begin(), s.end(), [](unsigned char ch) {
-                return !std::isspace(ch);
-            }));
-    return s;
+std::string_view trim(std::string_view s) {
+    size_t first = 0;
+    while (first < s.size() && std::isspace(static_cast<unsigned char>(s[first])))
+        ++first;
+    size_t last = s.size();
+    while (last > first
+           && std::isspace(static_cast<unsigned char>(s[last - 1])))
+        --last;
+    return s.substr(first, last - first);
+}
+
+// Returns the next line of text (without its newline) and advances pos
+std::string_view nextLine(std::string_view text, size_t &pos) {
+    size_t end = text.find('\n', pos);
+    if (end == std::string_view::npos)
+        end = text.size();
+    std::string_view line = text.substr(pos, end - pos);
+    pos = end + 1;
+    return line;
 }
 
-std::string rtrim(std::string s) {
-    s.erase(std::find_if(s.rbegin(), s.rend(),
-                         [](unsigned char ch) { return !std::isspace(ch); })
-                .base(),
-            s.end());
-    return s;
+// Returns the field up to the next ',' and advances past it. A missing
+// field comes back empty.
+std::string_view nextField(std::string_view &rest) {
+    size_t comma = rest.find(',');
+    std::string_view field = rest.substr(0, comma);
+    rest = comma == std::string_view::npos ? std::string_view()
+                                           : rest.substr(comma + 1);
+    return field;
 }
 
-std::string trim(std::string s) {
-    s = ltrim(s);
-    s = rtrim(s);
-    return s;
+// Like std::stoi on a trimmed field: reads a leading integer with an
+// optional '+' or '-' sign and ignores anything after it. from_chars alone
+// rejects the '+'.
+bool parseInt(std::string_view s, int &value) {
+    if (s.size() > 1 && s[0] == '+' && s[1] != '-')
+        s.remove_prefix(1);
+    auto result = std::from_chars(s.data(), s.data() + s.size(), value);
+    return result.ec == std::errc();
+}
+
+// One line of the [Territories] section, tokenized but not yet added to
+// the map
+struct ParsedTerritory {
+    std::string_view text; // The whole trimmed line
+    std::string_view name;
+    std::string_view continentName;
+    Continent* continent; // nullptr if no continent has that name
+    int x;
+    int y;
+    bool validCoordinates;
+    size_t line; // Line number within the chunk, 1-based
+};
+
+// A run of whole lines of the [Territories] section. Adjacent names of the
+// chunk's i-th territory are adjacentNames[offsets[i]..offsets[i+1]).
+struct TerritoryChunk {
+    std::string_view text;
+    size_t firstLine = 0; // Lines in the file before this chunk
+    size_t lineCount = 0;
+    std::vector<ParsedTerritory> territories;
+    std::vector<std::string_view> adjacentNames;
+    std::vector<size_t> adjacentOffsets;
+    std::vector<int> adjacent; // Resolved adjacentNames, -1 if unknown
+};
+
+// Tokenizes a chunk. Only reads the map (continent lookups), so chunks can
+// be parsed concurrently.
+void parseTerritoryChunk(const Map &map, TerritoryChunk &chunk) {
+    size_t pos = 0;
+    chunk.adjacentOffsets.assign(1, 0);
+    while (pos < chunk.text.size()) {
+        std::string_view line = trim(nextLine(chunk.text, pos));
+        ++chunk.lineCount;
+        if (line.empty())
+            continue;
+
+        // Split first 4 values by ','
+        ParsedTerritory territory;
+        std::string_view rest = line;
+        territory.text = line;
+        territory.name = trim(nextField(rest));
+        std::string_view posX = trim(nextField(rest));
+        std::string_view posY = trim(nextField(rest));
+        territory.continentName = trim(nextField(rest));
+        territory.continent = map.findContinent(territory.continentName);
+        territory.x = 0;
+        territory.y = 0;
+        territory.validCoordinates =
+            parseInt(posX, territory.x) && parseInt(posY, territory.y);
+        territory.line = chunk.lineCount;
+        chunk.territories.push_back(territory);
+
+        // The rest of the line are adjacent territories, separated by ','
+        while (!rest.empty())
+            chunk.adjacentNames.push_back(trim(nextField(rest)));
+        chunk.adjacentOffsets.push_back(chunk.adjacentNames.size());
+    }
+}
+
+// Splits text into about count pieces, each ending at a line boundary
+std::vector<std::string_view> splitLines(std::string_view text, size_t count) {
+    std::vector<std::string_view> pieces;
+    size_t target = text.size() / count + 1;
+    size_t start = 0;
+    while (start < text.size()) {
+        size_t end = text.find('\n', std::min(text.size(), start + target));
+        end = end == std::string_view::npos ? text.size() : end + 1;
+        pieces.push_back(text.substr(start, end - start));
+        start = end;
+    }
+    return pieces;
 }
 } // namespace
 
@@ -42,30 +144,79 @@ MapLoader::~MapLoader() {
 }
 
 // In [Map] section, convert "yes" to true, "no" to false
-bool MapLoader::convertStrToBool(const std::string &str) {
+bool MapLoader::convertStrToBool(std::string_view str) {
     return str == "yes";
 }
 
-Map* MapLoader::loadMap() {
-    std::ifstream file(*filename);
-    std::string line;
+// Records a diagnostic; in verbose mode it is also printed as it is found
+void MapLoader::report(MapDiagnostic::Severity severity,
+                       MapDiagnostic::Kind kind,
+                       size_t line,
+                       std::string message) {
+    diagnostics.add(severity, kind, line, std::move(message));
+    if (verbose)
+        LOG_INFO << diagnostics.getEntries().back() << std::endl;
+}
 
-    if (!file.is_open()) {
-        std::cerr << "Could not open the file: " << filename << std::endl;
+// The file is mapped and tokenized in place. Territories are created in one
+// pass; their adjacency names are kept as views in one flat array and
+// resolved through the map's name table once every territory exists.
+Map* MapLoader::loadMap() {
+    using Severity = MapDiagnostic::Severity;
+    using Kind = MapDiagnostic::Kind;
+
+    diagnostics.clear();
+    validated = false;
+    sourceHash = 0;
+    MappedFile file(*filename);
+    if (!file.isOpen()) {
+        diagnostics.add(Severity::Error, Kind::FileNotFound, 0,
+                        "Could not open the file: " + *filename);
+        if (verbose)
+            std::cerr << "Could not open the file: " << *filename << std::endl;
         return nullptr;
     }
 
+    std::string_view text = file.view();
+    size_t pos = 0;
+    size_t lineNumber = 0;
+    std::string_view line;
+
     std::string worldName = filename->substr(0, filename->size() - 4);
 
+    std::string cachePath;
+    if (useCache) {
+        sourceHash = fnv1aHash(text);
+        cachePath = CompiledMap::cachePathFor(*filename);
+        StreamingValidator cachedValidator;
+        if (Map* map = CompiledMap::read(
+                cachePath, sourceHash, text.size(), worldName,
+                streamingValidation ? &cachedValidator : nullptr)) {
+            if (streamingValidation) {
+                validation = cachedValidator.finish(*map);
+                validated = true;
+            }
+            if (verbose) {
+                LOG_DEBUG << "Loaded compiled map " << cachePath << std::endl;
+                LOG_DEBUG << "Created Map: " << map->getName() << std::endl
+                          << "Author: " << map->getAuthor()
+                          << ", Image: " << map->getImage() << std::endl;
+            }
+            return map;
+        }
+    }
+
     bool wrap = false;
     bool warn = false;
     std::string author = "";
     std::string image = "";
     std::string scroll = "";
 
-    std::cout << "Starting to read map file..." << std::endl;
-    while (std::getline(file, line)) {
-        line = trim(line);
+    if (verbose)
+        LOG_DEBUG << "Starting to read map file..." << std::endl;
+    while (pos < text.size()) {
+        line = trim(nextLine(text, pos));
+        ++lineNumber;
         if (line.empty())
             continue;
 
@@ -78,151 +229,203 @@ Map* MapLoader::loadMap() {
         getMapDetails(line, wrap, warn, author, image, scroll);
     }
 
-    std::cout << "Done reading [Map] section." << std::endl;
-
     Map* map = new Map(wrap, warn, author, image, worldName, scroll);
 
-    std::cout << "Created Map: " << map->getName() << std::endl
-              << "Author: " << map->getAuthor()
-              << ", Image: " << map->getImage() << std::endl;
-
-    std::cout << "Starting to parse continents..." << std::endl;
+    if (verbose) {
+        LOG_DEBUG << "Done reading [Map] section." << std::endl;
+        LOG_DEBUG << "Created Map: " << map->getName() << std::endl
+                  << "Author: " << map->getAuthor()
+                  << ", Image: " << map->getImage() << std::endl;
+        LOG_DEBUG << "Starting to parse continents..." << std::endl;
+    }
     // Parsing Continents
-    while (std::getline(file, line)) {
-        line = trim(line);
+    while (pos < text.size()) {
+        line = trim(nextLine(text, pos));
+        ++lineNumber;
         if (line.empty())
             continue;
         if (line == TERRITORY_SECTION_HEADER) {
-            std::cout << "Finished parsing continents, moving to territories..."
-                      << std::endl;
+            if (verbose)
+                LOG_DEBUG
+                    << "Finished parsing continents, moving to territories..."
+                    << std::endl;
             break;
         }
 
-        std::string continentName;
+        std::string_view continentName;
         int bonus;
 
+        if (line.find('=') == std::string_view::npos)
+            report(Severity::Warning, Kind::MalformedContinent, lineNumber,
+                   "Continent line \"" + std::string(line)
+                       + "\" is not of the form name=bonus.");
         getContinentDetails(line, continentName, bonus);
-        Continent* continent = new Continent(continentName, bonus);
+        Continent* continent = new Continent(std::string(continentName), bonus);
 
-        std::cout << "Created Continent: " << continent->getName() << std::endl;
+        if (verbose)
+            LOG_DEBUG << "Created Continent: " << continent->getName()
+                      << std::endl;
         map->addContinent(continent);
     }
 
-    // Create a map of continent names to continent pointers for easy lookup
-    //  This is needed to associate territories with correct continents
-    std::unordered_map<std::string, Continent*> nameToContinent;
-
-    // Associate continent names to continent pointers
-    for (Continent* continent : map->getContinents()) {
-        nameToContinent[continent->getName()] = continent;
+    // Tokenize the territory lines, in parallel chunks when the section is
+    // large enough to pay for it
+    std::string_view section = text.substr(std::min(pos, text.size()));
+    std::unique_ptr<ThreadPool> ownPool;
+    ThreadPool* pool = nullptr;
+    if (threads == 0 && section.size() >= ParallelThreshold) {
+        pool = &ThreadPool::shared();
+    } else if (threads > 1) {
+        ownPool = std::make_unique<ThreadPool>(threads);
+        pool = ownPool.get();
+    }
+    std::vector<TerritoryChunk> chunks;
+    if (pool && pool->size() > 1) {
+        for (std::string_view piece : splitLines(section, pool->size() * 4))
+            chunks.emplace_back().text = piece;
+        pool->parallelFor(chunks.size(), [&](size_t c) {
+            parseTerritoryChunk(*map, chunks[c]);
+        });
+    } else {
+        pool = nullptr;
+        chunks.emplace_back().text = section;
+        parseTerritoryChunk(*map, chunks[0]);
     }
 
-    // Create a map of territory names to territory pointers
-    // This is needed to associate adjacent territories correctly
-    std::unordered_map<std::string, Territory*> nameToTerritory;
-
-    // This will be later  used to associate territories with their adjacent
-    // territories
-    //  after all territories have been created
-    std::unordered_map<Territory*, std::vector<std::string>>
-        territoryToAdjacentNames;
+    // Merge in file order: names are interned one at a time, so territory
+    // IDs and diagnostics come out exactly as a sequential parse would
+    if (verbose)
+        LOG_DEBUG << "Starting to parse territories..." << std::endl;
+    size_t territoryCount = 0;
+    for (TerritoryChunk &chunk : chunks) {
+        chunk.firstLine = lineNumber;
+        lineNumber += chunk.lineCount;
+        territoryCount += chunk.territories.size();
+    }
+    map->reserve(territoryCount, map->getContinents().size());
+    std::unique_ptr<StreamingValidator> validator;
+    if (streamingValidation)
+        validator = std::make_unique<StreamingValidator>(
+            static_cast<int>(map->getContinents().size()));
+    for (const TerritoryChunk &chunk : chunks) {
+        for (const ParsedTerritory &parsed : chunk.territories) {
+            size_t line = chunk.firstLine + parsed.line;
+            if (verbose)
+                LOG_TRACE << "Processing territory: " << parsed.text
+                          << std::endl;
+            if (!parsed.validCoordinates) {
+                report(Severity::Error, Kind::InvalidCoordinates, line,
+                       "Invalid coordinates for Territory "
+                           + std::string(parsed.name) + ", using ("
+                           + std::to_string(parsed.x) + ", "
+                           + std::to_string(parsed.y) + ").");
+            }
 
-    std::cout << "Starting to parse territories..." << std::endl;
-    while (std::getline(file, line)) {
-        line = trim(line);
-        if (line.empty())
-            continue;
+            if (map->findTerritory(parsed.name)) {
+                report(Severity::Warning, Kind::DuplicateTerritory, line,
+                       "Territory " + std::string(parsed.name)
+                           + " is defined more than once; the last one is "
+                             "used.");
+            }
 
-        std::cout << "Processing territory: " << line << std::endl;
-        std::istringstream ss(line);
-        std::string name, posX, posY, continentName;
-        // Split first 4 values by ','
-        std::getline(ss, name, ',');
-        std::getline(ss, posX, ',');
-        std::getline(ss, posY, ',');
-        std::getline(ss, continentName, ',');
-
-        name = trim(name);
-        int x = std::stoi(posX);
-        int y = std::stoi(posY);
-        continentName = trim(continentName);
-
-        Territory* territory = new Territory(name, x, y);
-        // Add the territory to name-to-territory
-        // map for looking up later (to associate with correct continent)
-        nameToTerritory[name] = territory;
-
-        // Add territory to the map
-        map->addTerritory(territory);
-
-        // Associate territory with correct continent
-        //  If continent not found, print error
-        //  If found, add territory to continent's territory list
-        if (nameToContinent.find(continentName) != nameToContinent.end()) {
-            Continent* continent = nameToContinent[continentName];
-            continent->addTerritory(territory);
-        } else {
-            // error handling if territory doesn't exist
-            std::cout << "**ERROR**: Continent " << continentName
-                      << " for Territory " << name << " is not found."
-                      << std::endl;
+            // Create the territory in the map, which also makes it findable
+            // by name
+            Territory* territory =
+                map->createTerritory(parsed.name, parsed.x, parsed.y);
+
+            // Associate territory with correct continent
+            //  If continent not found, record an error
+            //  If found, add territory to continent's territory list
+            if (validator) {
+                validator->addTerritory(
+                    parsed.continent ? parsed.continent->getId() : -1);
+                if (parsed.continent)
+                    validator->addMembership(territory->getId());
+            }
+            if (parsed.continent) {
+                parsed.continent->addTerritory(territory);
+            } else {
+                report(Severity::Error, Kind::UnknownContinent, line,
+                       "Continent " + std::string(parsed.continentName)
+                           + " for Territory " + std::string(parsed.name)
+                           + " is not found.");
+            }
         }
+    }
 
-        // After adding the territory continent, parse the rest of the line
-        //  The rest of the line are adjacent territories, separated by ','
-        std::vector<std::string> adjacentNames;
-        std::string adjacentName;
-        // Read remaining adjacent territory names
-        //  and store them in a map of territory to its adjacent names
-        while (std::getline(ss, adjacentName, ',')) {
-            adjacentNames.push_back(trim(adjacentName));
-        }
-        //< *terr -> [adj1, adj2, ...], ... >
-        territoryToAdjacentNames[territory] = adjacentNames;
+    // Now that all territories are created, look up the adjacent names in
+    // the map's name table (read-only, so chunks resolve in parallel)
+    auto resolveChunk = [&](size_t c) {
+        TerritoryChunk &chunk = chunks[c];
+        chunk.adjacent.resize(chunk.adjacentNames.size());
+        for (size_t i = 0; i < chunk.adjacentNames.size(); ++i)
+            chunk.adjacent[i] = map->findTerritoryId(chunk.adjacentNames[i]);
+    };
+    if (pool) {
+        pool->parallelFor(chunks.size(), resolveChunk);
+    } else {
+        resolveChunk(0);
     }
 
-    // Now that all territories are created, associate adjacent territories
-    //  by looking up the names in nameToTerritory map
-
-    // use "auto" to avoid long type declaration
-    for (auto &pair : territoryToAdjacentNames) {
-        // get the key from the K-V pair
-        Territory* territory = pair.first;
-        // for each adjacent territory name, look up the territory pointer
-        //  and add it to the territory's adjacent list
-        for (const std::string &adjName : pair.second) {
-            if (nameToTerritory.find(adjName) != nameToTerritory.end()) {
-                Territory* adjacentTerritory = nameToTerritory[adjName];
-                territory->addAdjacentTerritory(adjacentTerritory);
-            } else {
-                // Error handling if adjacent territory doesn't exist
-                std::cout << "**ERROR**: Adjacent Territory " << adjName
-                          << " for Territory " << territory->getName()
-                          << " is not found." << std::endl;
+    // Then associate adjacent territories in file order
+    int id = 0;
+    for (const TerritoryChunk &chunk : chunks) {
+        for (size_t t = 0; t < chunk.territories.size(); ++t, ++id) {
+            Territory* territory = map->getTerritory(id);
+            for (size_t i = chunk.adjacentOffsets[t];
+                 i < chunk.adjacentOffsets[t + 1]; ++i) {
+                int adjacentId = chunk.adjacent[i];
+                if (adjacentId >= 0) {
+                    territory->addAdjacentTerritory(
+                        map->getTerritory(adjacentId));
+                    if (validator)
+                        validator->addEdge(id, adjacentId);
+                } else {
+                    report(Severity::Error, Kind::UnresolvedAdjacency,
+                           chunk.firstLine + chunk.territories[t].line,
+                           "Adjacent Territory "
+                               + std::string(chunk.adjacentNames[i])
+                               + " for Territory " + territory->getName()
+                               + " is not found.");
+                }
             }
         }
     }
 
-    file.close();
+    // Flatten the adjacency lists into the map's contiguous CSR index
+    map->buildAdjacencyIndex();
+
+    if (validator) {
+        validation = validator->finish(*map);
+        validated = true;
+    }
+
+    // Only maps without any diagnostics are compiled, so a cache hit never
+    // hides a problem the parser would have reported
+    if (useCache && diagnostics.empty()
+        && !CompiledMap::write(*map, cachePath, sourceHash, text.size())
+        && verbose)
+        LOG_INFO << "Could not write compiled map " << cachePath << std::endl;
+
     return map;
 }
 
 // Helper functions to parse lines in [Map]
 // Split line at '=', trim spaces, and assign to correct variables
 // substr (0, pos) is key | substr (pos+1) to end is value
-void MapLoader::getMapDetails(const std::string line,
+void MapLoader::getMapDetails(std::string_view line,
                               bool &wrap,
                               bool &warn,
                               std::string &author,
                               std::string &image,
                               std::string &scroll) {
     size_t pos = line.find('=');
-    if (pos == std::string::npos) {
+    if (pos == std::string_view::npos) {
         return; // not a key=value line
     }
 
-    std::string key = trim(line.substr(0, pos));
-    std::string value = trim(line.substr(pos + 1));
+    std::string_view key = trim(line.substr(0, pos));
+    std::string_view value = trim(line.substr(pos + 1));
 
     if (key == "author") {
         author = value;
@@ -239,22 +442,17 @@ void MapLoader::getMapDetails(const std::string line,
 
 // In [Continents] section, split line at '=', trim spaces,
 // assign left side to name, right side to bonus (convert to int)
-void MapLoader::getContinentDetails(const std::string line,
-                                    std::string &name,
+void MapLoader::getContinentDetails(std::string_view line,
+                                    std::string_view &name,
                                     int &bonus) {
     size_t pos = line.find('=');
-    if (pos == std::string::npos) {
-        name.clear();
+    if (pos == std::string_view::npos) {
+        name = std::string_view();
         bonus = 0;
         return;
     }
 
     name = trim(line.substr(0, pos));
-    std::string bonusStr = trim(line.substr(pos + 1));
-
-    try {
-        bonus = std::stoi(bonusStr);
-    } catch (...) {
+    if (!parseInt(trim(line.substr(pos + 1)), bonus))
         bonus = 0;
-    }
 }
@@ -1,26 +1,81 @@
 #pragma once
 #include "Map.h"
+#include "MapDiagnostics.h"
+#include <cstdint>
 #include <string>
+#include <string_view>
 
 class MapLoader {
   private:
     std::string* filename;
+    bool useCache = true;
+    bool verbose = true;
+    unsigned threads = 0;
+    bool streamingValidation = false;
+    uint64_t sourceHash = 0;     // Of the file read by the last loadMap()
+    bool validated = false;      // Whether validation holds a result
+    ValidationReport validation; // From the last parse, if streaming
+    MapDiagnostics diagnostics; // Problems found by the last loadMap()
 
-    bool convertStrToBool(const std::string &str);
+    bool convertStrToBool(std::string_view str);
 
-    void getMapDetails(const std::string line,
+    void getMapDetails(std::string_view line,
                        bool &wrap,
                        bool &warn,
                        std::string &author,
                        std::string &image,
                        std::string &scroll);
 
-    void
-    getContinentDetails(const std::string line, std::string &name, int &bonus);
+    void getContinentDetails(std::string_view line,
+                             std::string_view &name,
+                             int &bonus);
+
+    void report(MapDiagnostic::Severity severity,
+                MapDiagnostic::Kind kind,
+                size_t line,
+                std::string message);
 
   public:
     MapLoader(const std::string &filename);
     ~MapLoader();
 
+    // Loads the map, preferring the compiled cache next to the file (see
+    // CompiledMap) when it matches the source, and compiling one after a
+    // parse without diagnostics
     Map* loadMap();
-};
\ No newline at end of file
+
+    void setUseCache(bool enabled) { useCache = enabled; }
+    bool getUseCache() const { return useCache; }
+    // FNV-1a hash of the source file, computed by loadMap() to check the
+    // compiled cache; 0 when the cache is off or the file was not read
+    uint64_t getSourceHash() const { return sourceHash; }
+
+    // Verbose loading (the default) narrates progress and prints each
+    // diagnostic as it is found. A silent load writes nothing to the
+    // console; read getDiagnostics() afterwards instead.
+    void setVerbose(bool enabled) { verbose = enabled; }
+    bool isVerbose() const { return verbose; }
+    const MapDiagnostics &getDiagnostics() const { return diagnostics; }
+
+    // Threads used to tokenize the [Territories] section and resolve
+    // adjacency. 0 (the default) uses the shared pool once the section is
+    // at least ParallelThreshold bytes, 1 parses sequentially, and N > 1
+    // always splits the work over N threads. The map and diagnostics are
+    // the same whatever the setting.
+    static constexpr size_t ParallelThreshold = 1 << 20;
+    void setThreads(unsigned count) { threads = count; }
+    unsigned getThreads() const { return threads; }
+
+    // When enabled, the parser feeds territories and edges to a
+    // StreamingValidator, so the validation rules are decided as parsing
+    // ends without walking the map again. The report is then available
+    // from getValidationReport(), or nullptr when streaming is off. Maps
+    // rebuilt from the compiled cache are validated the same way.
+    void setStreamingValidation(bool enabled) {
+        streamingValidation = enabled;
+    }
+    bool getStreamingValidation() const { return streamingValidation; }
+    const ValidationReport* getValidationReport() const {
+        return validated ? &validation : nullptr;
+    }
+};
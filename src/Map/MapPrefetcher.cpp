@@ -0,0 +1,68 @@
+#include "MapPrefetcher.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <utility>
+
+namespace {
+double millisecondsSince(std::chrono::steady_clock::time_point since) {
+    return std::chrono::duration<double, std::milli>(
+               std::chrono::steady_clock::now() - since)
+        .count();
+}
+} // namespace
+
+MapPrefetcher::MapPrefetcher(std::vector<std::string> paths,
+                             size_t depth,
+                             MapRegistry &registry,
+                             ThreadPool &pool)
+    : paths(std::move(paths)), depth(depth), registry(registry), pool(pool) {
+    // The first map is needed right away, the next depth maps soon after
+    while (queued < this->paths.size() && queued <= depth)
+        queueNext();
+}
+
+MapPrefetcher::~MapPrefetcher() {
+    for (std::future<Loaded> &load : pending)
+        load.wait();
+}
+
+void MapPrefetcher::queueNext() {
+    std::string path = paths[queued++];
+    MapRegistry* target = &registry;
+    pending.push_back(pool.submit([target, path]() {
+        auto start = std::chrono::steady_clock::now();
+        std::shared_ptr<const RegisteredMap> entry = target->acquire(path);
+        return Loaded{entry, millisecondsSince(start)};
+    }));
+}
+
+std::shared_ptr<const RegisteredMap> MapPrefetcher::next() {
+    if (!hasNext())
+        return nullptr;
+
+    auto start = std::chrono::steady_clock::now();
+    Loaded loaded = pending.front().get();
+    stallMs += millisecondsSince(start);
+    pending.pop_front();
+    loadMs += loaded.loadMs;
+    ++taken;
+
+    // Keep depth maps loading behind the one just handed out
+    if (queued < paths.size())
+        queueNext();
+    return loaded.entry;
+}
+
+std::ostream &operator<<(std::ostream &os, const MapPrefetcher &prefetcher) {
+    std::ios_base::fmtflags flags = os.flags();
+    std::streamsize precision = os.precision();
+    os << std::fixed << std::setprecision(1) << "Map prefetch: "
+       << prefetcher.taken << " maps, " << prefetcher.loadMs
+       << " ms loading, " << prefetcher.stallMs << " ms stalled ("
+       << prefetcher.getHiddenMs() << " ms off the critical path)";
+    os.flags(flags);
+    os.precision(precision);
+    return os;
+}
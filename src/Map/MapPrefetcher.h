@@ -0,0 +1,60 @@
+#pragma once
+#include "MapRegistry.h"
+#include "Utils/ThreadPool.h"
+#include <cstddef>
+#include <deque>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Loads a known sequence of maps ahead of use. While the caller plays on
+// map N, maps N+1..N+depth are loaded and validated into the registry on
+// pool threads, so next() normally returns without waiting.
+class MapPrefetcher {
+  private:
+    // What a background load hands back
+    struct Loaded {
+        std::shared_ptr<const RegisteredMap> entry;
+        double loadMs;
+    };
+
+    std::vector<std::string> paths;
+    size_t depth;
+    MapRegistry &registry;
+    ThreadPool &pool;
+    size_t queued = 0; // Paths handed to the pool so far
+    std::deque<std::future<Loaded>> pending;
+
+    double loadMs = 0.0;  // Time spent loading, wherever it ran
+    double stallMs = 0.0; // Time next() spent waiting for a load
+    size_t taken = 0;
+
+    void queueNext();
+
+  public:
+    MapPrefetcher(std::vector<std::string> paths,
+                  size_t depth = 1,
+                  MapRegistry &registry = MapRegistry::shared(),
+                  ThreadPool &pool = ThreadPool::shared());
+    ~MapPrefetcher(); // Waits for loads still in flight
+    MapPrefetcher(const MapPrefetcher &) = delete;
+    MapPrefetcher &operator=(const MapPrefetcher &) = delete;
+
+    bool hasNext() const { return taken < paths.size(); }
+    // The next map in sequence, waiting for it if it is still loading
+    std::shared_ptr<const RegisteredMap> next();
+
+    size_t getMapCount() const { return taken; }
+    double getLoadMs() const { return loadMs; }
+    double getStallMs() const { return stallMs; }
+    // Load time kept off the caller's thread
+    double getHiddenMs() const {
+        return loadMs > stallMs ? loadMs - stallMs : 0.0;
+    }
+
+    // e.g. "Map prefetch: 2 maps, 14.2 ms loading, 0.3 ms stalled ..."
+    friend std::ostream &operator<<(std::ostream &os,
+                                    const MapPrefetcher &prefetcher);
+};
@@ -0,0 +1,87 @@
+#include "MapRegistry.h"
+
+#include "MapLoader.h"
+
+Map* RegisteredMap::instantiate() const {
+    return map ? map->cloneTopology() : nullptr;
+}
+
+// Checking the file's size and modification time costs one stat() per
+// call, and still lets an edited map be picked up without restarting
+std::shared_ptr<const RegisteredMap>
+MapRegistry::acquire(const std::string &path) {
+    std::error_code sizeError;
+    std::error_code timeError;
+    std::uintmax_t fileSize = std::filesystem::file_size(path, sizeError);
+    std::filesystem::file_time_type modified =
+        std::filesystem::last_write_time(path, timeError);
+    // A file that cannot be stat'ed is loaded, failing, but never cached
+    bool stamped = !sizeError && !timeError;
+
+    if (stamped) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto found = entries.find(path);
+        if (found != entries.end() && found->second->fileSize == fileSize
+            && found->second->modified == modified) {
+            ++reuses;
+            return found->second;
+        }
+    }
+
+    // Load outside the lock so other maps can be acquired meanwhile
+    auto entry = std::make_shared<RegisteredMap>();
+    entry->path = path;
+    entry->fileSize = fileSize;
+    entry->modified = modified;
+    MapLoader loader(path);
+    loader.setVerbose(false);
+    loader.setStreamingValidation(true);
+    Map* map = loader.loadMap();
+    // The loader hashes the file to check its compiled cache
+    entry->contentHash = loader.getSourceHash();
+    entry->diagnostics = loader.getDiagnostics();
+    if (map) {
+        // The loader decides the rules as it builds the map
+        if (const ValidationReport* report = loader.getValidationReport())
+            entry->validation = *report;
+        else
+            entry->validation = map->validateWithReport();
+        entry->map.reset(map);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    ++loads;
+    if (!entry->map || !stamped)
+        return entry;
+    // Another thread may have loaded the same file meanwhile; keep one
+    auto &slot = entries[path];
+    if (slot && slot->fileSize == fileSize && slot->modified == modified)
+        return slot;
+    slot = entry;
+    return entry;
+}
+
+void MapRegistry::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+}
+
+size_t MapRegistry::size() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+}
+
+size_t MapRegistry::getLoadCount() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return loads;
+}
+
+size_t MapRegistry::getReuseCount() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return reuses;
+}
+
+MapRegistry &MapRegistry::shared() {
+    static MapRegistry registry;
+    return registry;
+}
@@ -0,0 +1,61 @@
+#pragma once
+#include "Map.h"
+#include "MapDiagnostics.h"
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+// A map file loaded, indexed and validated once. The map itself is never
+// modified after loading; games play on clones made by instantiate().
+struct RegisteredMap {
+    std::string path;
+    uint64_t contentHash = 0;
+    // Size and modification time of the file when it was loaded
+    std::uintmax_t fileSize = 0;
+    std::filesystem::file_time_type modified;
+    std::shared_ptr<const Map> map; // nullptr if the file failed to load
+    MapDiagnostics diagnostics;
+    ValidationReport validation;
+
+    bool isLoaded() const { return map != nullptr; }
+    bool isValid() const { return map && validation.isValid(); }
+
+    // Fresh map for one game: the same topology with an empty board.
+    // nullptr if not loaded.
+    Map* instantiate() const;
+};
+
+// Cache of loaded maps keyed by path. An entry is reused as long as the
+// file's size and modification time are unchanged, so a tournament parses,
+// indexes and validates each map once however many games it plays on it.
+// Safe to use from several threads.
+class MapRegistry {
+  private:
+    std::mutex mutex;
+    std::unordered_map<std::string, std::shared_ptr<const RegisteredMap>>
+        entries;
+    size_t loads = 0;
+    size_t reuses = 0;
+
+  public:
+    MapRegistry() = default;
+    MapRegistry(const MapRegistry &) = delete;
+    MapRegistry &operator=(const MapRegistry &) = delete;
+
+    // The registered map for path, loading it if it is new or has changed
+    // on disk. A file that cannot be read gives an unloaded entry with the
+    // error in its diagnostics; such entries are not cached.
+    std::shared_ptr<const RegisteredMap> acquire(const std::string &path);
+
+    void clear();
+    size_t size();
+    size_t getLoadCount();
+    size_t getReuseCount();
+
+    // Process-wide registry
+    static MapRegistry &shared();
+};
@@ -0,0 +1,56 @@
+#include "MapSnapshot.h"
+#include <algorithm>
+
+Player* MapSnapshot::getOwner(int id) const {
+    int ownerIndex = (*owners)[id];
+    return ownerIndex < 0 ? nullptr : (*ownerTable)[ownerIndex];
+}
+
+// Owners never seen before are appended to this snapshot's owner table
+void MapSnapshot::setOwner(int id, Player* player) {
+    int ownerIndex = -1;
+    if (player) {
+        const std::vector<Player*> &table = *ownerTable;
+        auto it = std::find(table.begin(), table.end(), player);
+        if (it == table.end()) {
+            detach(ownerTable).push_back(player);
+            ownerIndex = static_cast<int>(ownerTable->size()) - 1;
+        } else {
+            ownerIndex = static_cast<int>(it - table.begin());
+        }
+    }
+    if ((*owners)[id] != ownerIndex)
+        detach(owners)[id] = ownerIndex;
+}
+
+int MapSnapshot::countOwnedBy(const Player* player) const {
+    const std::vector<Player*> &table = *ownerTable;
+    auto it = std::find(table.begin(), table.end(), player);
+    if (!player || it == table.end())
+        return 0;
+    int ownerIndex = static_cast<int>(it - table.begin());
+    return static_cast<int>(
+        std::count(owners->begin(), owners->end(), ownerIndex));
+}
+
+const MapSnapshot::PlayerState*
+MapSnapshot::getPlayerState(const Player* player) const {
+    for (const PlayerState &state : *players) {
+        if (state.player == player)
+            return &state;
+    }
+    return nullptr;
+}
+
+void MapSnapshot::setReinforcementPool(const Player* player, int amount) {
+    if (!getPlayerState(player))
+        return;
+    for (PlayerState &state : detach(players)) {
+        if (state.player == player)
+            state.reinforcementPool = amount;
+    }
+}
+
+bool MapSnapshot::sharesBoardWith(const MapSnapshot &other) const {
+    return armies == other.armies && owners == other.owners;
+}
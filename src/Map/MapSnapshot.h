@@ -0,0 +1,64 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// Forward declarations
+class Map;
+class Player;
+
+// The board's armies and owners, plus the players' reinforcement pools,
+// captured for what-if simulation. Hands, pending orders and the deck are
+// not part of a snapshot: orders are deleted as they execute and played
+// cards move to the engine's deck, so they are not the map's to restore.
+// A snapshot refers to its map for the topology, which it never changes.
+// Copying a snapshot forks it: the copies share their armies and owner
+// columns and the captured player state, and a column is cloned only when
+// a copy first writes to it (copy-on-write).
+// A snapshot must not outlive its map. A snapshot being forked must not be
+// written by another thread at the same time.
+class MapSnapshot {
+  public:
+    // What a player holds outside the board when the snapshot is taken
+    struct PlayerState {
+        Player* player = nullptr;
+        int reinforcementPool = 0;
+    };
+
+  private:
+    const Map* map = nullptr;
+    std::shared_ptr<std::vector<int>> armies;
+    std::shared_ptr<std::vector<int>> owners; // Index into ownerTable, or -1
+    std::shared_ptr<std::vector<Player*>> ownerTable;
+    std::shared_ptr<std::vector<PlayerState>> players;
+
+    // Gives this snapshot its own copy of a shared buffer before a write
+    template <typename T> static T &detach(std::shared_ptr<T> &buffer) {
+        if (buffer.use_count() > 1)
+            buffer = std::make_shared<T>(*buffer);
+        return *buffer;
+    }
+
+    friend class Map;
+
+  public:
+    MapSnapshot() = default;
+
+    const Map* getMap() const { return map; }
+    size_t size() const { return armies ? armies->size() : 0; }
+
+    int getArmies(int id) const { return (*armies)[id]; }
+    void setArmies(int id, int amount) { detach(armies)[id] = amount; }
+    void addArmies(int id, int amount) { detach(armies)[id] += amount; }
+
+    Player* getOwner(int id) const;
+    void setOwner(int id, Player* player);
+    int countOwnedBy(const Player* player) const;
+
+    // Captured player state, or nullptr if the player was not captured
+    const PlayerState* getPlayerState(const Player* player) const;
+    void setReinforcementPool(const Player* player, int amount);
+
+    // True if both snapshots still share their armies and owner columns
+    bool sharesBoardWith(const MapSnapshot &other) const;
+};
@@ -0,0 +1,82 @@
+#include "NameTable.h"
+#include "Utils/Utils.h"
+
+// The slots refer to the stored strings by symbol, so copies re-intern
+// rather than share them.
+NameTable::NameTable(const NameTable &other) {
+    reserve(other.names.size());
+    for (const std::string &name : other.names)
+        intern(name);
+}
+
+NameTable &NameTable::operator=(const NameTable &other) {
+    if (this != &other) {
+        names.clear();
+        hashes.clear();
+        slots.clear();
+        reserve(other.names.size());
+        for (const std::string &name : other.names)
+            intern(name);
+    }
+    return *this;
+}
+
+// 64-bit FNV-1a with a final avalanche step: plain FNV keeps names that
+// differ only in their last digits close together, which lets linear probes
+// pile up into long runs
+uint32_t NameTable::hashOf(std::string_view name) {
+    uint64_t hash = fnv1aHash(name);
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= hash >> 33;
+    return static_cast<uint32_t>(hash);
+}
+
+// Slot holding name, or the empty slot where it would go
+size_t NameTable::findSlot(std::string_view name, uint32_t hash) const {
+    size_t mask = slots.size() - 1;
+    for (size_t i = hash & mask;; i = (i + 1) & mask) {
+        const Slot &slot = slots[i];
+        if (slot.symbol < 0
+            || (slot.hash == hash && names[slot.symbol] == name))
+            return i;
+    }
+}
+
+// Keeps the load factor at or below one half
+void NameTable::reserve(size_t count) {
+    size_t capacity = 16;
+    while (capacity < count * 2)
+        capacity *= 2;
+    if (capacity <= slots.size())
+        return;
+
+    slots.assign(capacity, Slot{0, -1});
+    size_t mask = capacity - 1;
+    for (size_t symbol = 0; symbol < names.size(); ++symbol) {
+        size_t i = hashes[symbol] & mask;
+        while (slots[i].symbol >= 0)
+            i = (i + 1) & mask;
+        slots[i] = Slot{hashes[symbol], static_cast<int>(symbol)};
+    }
+}
+
+int NameTable::intern(std::string_view name) {
+    reserve(names.size() + 1);
+    uint32_t hash = hashOf(name);
+    size_t slot = findSlot(name, hash);
+    if (slots[slot].symbol >= 0)
+        return slots[slot].symbol;
+
+    int symbol = static_cast<int>(names.size());
+    names.emplace_back(name);
+    hashes.push_back(hash);
+    slots[slot] = Slot{hash, symbol};
+    return symbol;
+}
+
+int NameTable::find(std::string_view name) const {
+    if (slots.empty())
+        return -1;
+    return slots[findSlot(name, hashOf(name))].symbol;
+}
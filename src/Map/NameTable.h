@@ -0,0 +1,44 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Interning table: each distinct name is stored once and identified by a
+// dense symbol ID. Stored strings never move, so references and views handed
+// out stay valid for the table's lifetime. Lookup goes through a flat
+// open-addressing hash of symbol IDs with linear probing.
+class NameTable {
+  private:
+    // A slot keeps the low hash bits beside the symbol so probes compare
+    // strings only on a likely match
+    struct Slot {
+        uint32_t hash;
+        int symbol; // -1 if empty
+    };
+
+    std::deque<std::string> names;
+    std::vector<uint32_t> hashes; // Per symbol, reused when the table grows
+    std::vector<Slot> slots;      // Size is a power of 2
+
+    static uint32_t hashOf(std::string_view name);
+    size_t findSlot(std::string_view name, uint32_t hash) const;
+
+  public:
+    NameTable() = default;
+    NameTable(const NameTable &other);
+    NameTable &operator=(const NameTable &other);
+
+    void reserve(size_t count);
+
+    // Returns the symbol for name, adding it on first use
+    int intern(std::string_view name);
+    // Returns the symbol for name, or -1 if it was never interned
+    int find(std::string_view name) const;
+
+    const std::string &get(int symbol) const { return names[symbol]; }
+    std::string_view view(int symbol) const { return names[symbol]; }
+    size_t size() const { return names.size(); }
+};
@@ -0,0 +1,221 @@
+#include "SpatialIndex.h"
+#include "Map.h"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+
+void SpatialIndex::build(const Map &map) {
+    clear();
+    territoryCount = map.getTerritoryCount();
+    if (territoryCount == 0)
+        return;
+
+    const TerritoryStore &store = map.getStore();
+    minX = maxX = store.getX(0);
+    minY = maxY = store.getY(0);
+    for (int id = 1; id < territoryCount; ++id) {
+        minX = std::min(minX, store.getX(id));
+        maxX = std::max(maxX, store.getX(id));
+        minY = std::min(minY, store.getY(id));
+        maxY = std::max(maxY, store.getY(id));
+    }
+
+    // About one territory per cell, with cells as square as the box allows
+    // and never narrower than one coordinate unit
+    int64_t spanX = int64_t(maxX) - minX + 1;
+    int64_t spanY = int64_t(maxY) - minY + 1;
+    double aspect = double(spanX) / double(spanY);
+    int64_t wanted =
+        std::llround(std::sqrt(double(territoryCount) * aspect));
+    int64_t columnCount = std::clamp<int64_t>(wanted, 1, territoryCount);
+    columnCount = std::min(columnCount, spanX);
+    int64_t rowCount = (territoryCount + columnCount - 1) / columnCount;
+    rowCount = std::min(rowCount, spanY);
+    cellWidth = (spanX + columnCount - 1) / columnCount;
+    cellHeight = (spanY + rowCount - 1) / rowCount;
+    columns = static_cast<int>((spanX + cellWidth - 1) / cellWidth);
+    rows = static_cast<int>((spanY + cellHeight - 1) / cellHeight);
+
+    // Counting sort of the territories by cell
+    std::vector<int> cellOf(territoryCount);
+    cellOffsets.assign(static_cast<size_t>(columns) * rows + 1, 0);
+    for (int id = 0; id < territoryCount; ++id) {
+        cellOf[id] =
+            rowOf(store.getY(id)) * columns + columnOf(store.getX(id));
+        ++cellOffsets[cellOf[id] + 1];
+    }
+    for (size_t c = 1; c < cellOffsets.size(); ++c)
+        cellOffsets[c] += cellOffsets[c - 1];
+    ids.resize(territoryCount);
+    xs.resize(territoryCount);
+    ys.resize(territoryCount);
+    std::vector<int> next(cellOffsets.begin(), cellOffsets.end() - 1);
+    for (int id = 0; id < territoryCount; ++id) {
+        int slot = next[cellOf[id]]++;
+        ids[slot] = id;
+        xs[slot] = store.getX(id);
+        ys[slot] = store.getY(id);
+    }
+}
+
+void SpatialIndex::clear() {
+    territoryCount = 0;
+    columns = rows = 0;
+    cellOffsets.clear();
+    ids.clear();
+    xs.clear();
+    ys.clear();
+}
+
+size_t SpatialIndex::memoryBytes() const {
+    return (cellOffsets.capacity() + ids.capacity() + xs.capacity()
+            + ys.capacity())
+        * sizeof(int);
+}
+
+// Coordinates outside the box fall into the nearest edge cell
+int SpatialIndex::columnOf(int64_t x) const {
+    if (x <= minX)
+        return 0;
+    return static_cast<int>(
+        std::min<int64_t>((x - minX) / cellWidth, columns - 1));
+}
+
+int SpatialIndex::rowOf(int64_t y) const {
+    if (y <= minY)
+        return 0;
+    return static_cast<int>(
+        std::min<int64_t>((y - minY) / cellHeight, rows - 1));
+}
+
+void SpatialIndex::withinRadius(int x,
+                                int y,
+                                double radius,
+                                std::vector<int> &out) const {
+    if (!isBuilt() || !(radius >= 0))
+        return;
+    // Clip the query's bounding box to the grid before converting, so huge
+    // radii cannot overflow
+    double left = std::max(x - radius, double(minX));
+    double right = std::min(x + radius, double(maxX));
+    double top = std::max(y - radius, double(minY));
+    double bottom = std::min(y + radius, double(maxY));
+    if (left > right || top > bottom)
+        return;
+
+    double radiusSquared = radius * radius;
+    int firstColumn = columnOf(static_cast<int64_t>(std::floor(left)));
+    int lastColumn = columnOf(static_cast<int64_t>(std::ceil(right)));
+    int firstRow = rowOf(static_cast<int64_t>(std::floor(top)));
+    int lastRow = rowOf(static_cast<int64_t>(std::ceil(bottom)));
+    for (int row = firstRow; row <= lastRow; ++row) {
+        int rowBase = row * columns;
+        for (int e = cellOffsets[rowBase + firstColumn];
+             e < cellOffsets[rowBase + lastColumn + 1]; ++e) {
+            double dx = double(xs[e]) - x;
+            double dy = double(ys[e]) - y;
+            if (dx * dx + dy * dy <= radiusSquared)
+                out.push_back(ids[e]);
+        }
+    }
+}
+
+void SpatialIndex::inRectangle(int left,
+                               int top,
+                               int right,
+                               int bottom,
+                               std::vector<int> &out) const {
+    if (!isBuilt() || left > right || top > bottom || right < minX
+        || left > maxX || bottom < minY || top > maxY)
+        return;
+
+    int firstColumn = columnOf(left);
+    int lastColumn = columnOf(right);
+    int firstRow = rowOf(top);
+    int lastRow = rowOf(bottom);
+    for (int row = firstRow; row <= lastRow; ++row) {
+        // A row's cells are contiguous, so one run covers the column span
+        int rowBase = row * columns;
+        for (int e = cellOffsets[rowBase + firstColumn];
+             e < cellOffsets[rowBase + lastColumn + 1]; ++e) {
+            if (xs[e] >= left && xs[e] <= right && ys[e] >= top
+                && ys[e] <= bottom)
+                out.push_back(ids[e]);
+        }
+    }
+}
+
+// Scans rings of cells around the query's cell, nearest ring first, and
+// stops once every cell not yet scanned lies farther away than the best
+// territory found so far
+int SpatialIndex::nearest(int x, int y) const {
+    if (!isBuilt())
+        return -1;
+
+    int best = -1;
+    int64_t bestDistance = INT64_MAX;
+    auto scanCell = [&](int column, int row) {
+        int cell = row * columns + column;
+        for (int e = cellOffsets[cell]; e < cellOffsets[cell + 1]; ++e) {
+            int64_t dx = int64_t(xs[e]) - x;
+            int64_t dy = int64_t(ys[e]) - y;
+            int64_t distance = dx * dx + dy * dy;
+            if (distance < bestDistance
+                || (distance == bestDistance && ids[e] < best)) {
+                bestDistance = distance;
+                best = ids[e];
+            }
+        }
+    };
+
+    int centerColumn = columnOf(x);
+    int centerRow = rowOf(y);
+    for (int ring = 0;; ++ring) {
+        int left = centerColumn - ring;
+        int right = centerColumn + ring;
+        int top = centerRow - ring;
+        int bottom = centerRow + ring;
+        for (int row = std::max(top, 0); row <= std::min(bottom, rows - 1);
+             ++row) {
+            if (row == top || row == bottom) {
+                for (int column = std::max(left, 0);
+                     column <= std::min(right, columns - 1); ++column)
+                    scanCell(column, row);
+            } else {
+                if (left >= 0)
+                    scanCell(left, row);
+                if (right < columns && right != left)
+                    scanCell(right, row);
+            }
+        }
+
+        // Every cell not yet scanned lies in a strip of the grid beyond one
+        // side of the square; stop once the best territory is closer than
+        // all of those strips
+        double gridLeft = minX;
+        double gridTop = minY;
+        double gridRight = minX + columns * cellWidth - 1.0;
+        double gridBottom = minY + rows * cellHeight - 1.0;
+        double bound = HUGE_VAL;
+        auto strip = [&](double x0, double x1, double y0, double y1) {
+            double dx = x < x0 ? x0 - x : (x > x1 ? x - x1 : 0.0);
+            double dy = y < y0 ? y0 - y : (y > y1 ? y - y1 : 0.0);
+            bound = std::min(bound, dx * dx + dy * dy);
+        };
+        if (left > 0)
+            strip(gridLeft, minX + left * cellWidth - 1.0, gridTop, gridBottom);
+        if (right < columns - 1)
+            strip(minX + (right + 1) * cellWidth, gridRight, gridTop,
+                  gridBottom);
+        if (top > 0)
+            strip(gridLeft, gridRight, gridTop, minY + top * cellHeight - 1.0);
+        if (bottom < rows - 1)
+            strip(gridLeft, gridRight, minY + (bottom + 1) * cellHeight,
+                  gridBottom);
+        if (bound == HUGE_VAL)
+            break; // Every cell has been scanned
+        if (best >= 0 && double(bestDistance) < bound)
+            break;
+    }
+    return best;
+}
@@ -0,0 +1,59 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Forward declarations
+class Map;
+
+// Uniform grid over territory coordinates.
+// The bounding box of the map is cut into roughly one cell per territory,
+// sized to the box's aspect ratio, and each cell lists its territories in a
+// single contiguous array (the same offsets + IDs layout as the adjacency
+// index). Queries only visit the cells their area overlaps, so on evenly
+// spread maps they cost O(cells touched + territories found) instead of a
+// scan over every territory. Distances are exact for coordinates within
+// +-2^30.
+class SpatialIndex {
+  private:
+    int territoryCount = 0;
+    int minX = 0;
+    int minY = 0;
+    int maxX = 0;
+    int maxY = 0;
+    int64_t cellWidth = 1;
+    int64_t cellHeight = 1;
+    int columns = 0;
+    int rows = 0;
+    // Territories of cell c are ids[cellOffsets[c]..cellOffsets[c+1]), with
+    // their coordinates alongside so a cell scan stays in one place
+    std::vector<int> cellOffsets;
+    std::vector<int> ids;
+    std::vector<int> xs;
+    std::vector<int> ys;
+
+    int columnOf(int64_t x) const;
+    int rowOf(int64_t y) const;
+
+  public:
+    SpatialIndex() = default;
+
+    void build(const Map &map);
+    void clear();
+
+    bool isBuilt() const { return !cellOffsets.empty(); }
+    size_t memoryBytes() const;
+
+    // Territories whose coordinates lie within radius of (x, y), boundary
+    // included, appended to out in no particular order
+    void withinRadius(int x, int y, double radius, std::vector<int> &out) const;
+    // Territories inside the rectangle [left, right] x [top, bottom],
+    // boundary included, appended to out in no particular order
+    void inRectangle(int left,
+                     int top,
+                     int right,
+                     int bottom,
+                     std::vector<int> &out) const;
+    // Territory closest to (x, y), the lowest ID on ties, -1 on an empty map
+    int nearest(int x, int y) const;
+};
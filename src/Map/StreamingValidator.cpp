@@ -0,0 +1,103 @@
+#include "StreamingValidator.h"
+
+#include <chrono>
+
+#include "Map.h"
+
+namespace {
+// splitmix64 finalizer, so the sum of edge hashes is order-independent but
+// still sensitive to which way each edge points
+uint64_t edgeHash(int fromId, int toId) {
+    uint64_t x = (uint64_t(uint32_t(fromId)) << 32) | uint32_t(toId);
+    x += 0x9e3779b97f4a7c15ull;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+    return x ^ (x >> 31);
+}
+
+double elapsedMs(std::chrono::steady_clock::time_point since) {
+    return std::chrono::duration<double, std::milli>(
+               std::chrono::steady_clock::now() - since)
+        .count();
+}
+} // namespace
+
+StreamingValidator::StreamingValidator(int continentCount)
+    : continentGraph(continentCount), continentSizes(continentCount, 0),
+      continentMerges(continentCount, 0) {}
+
+void StreamingValidator::addContinent() {
+    continentGraph.add();
+    continentSizes.push_back(0);
+    continentMerges.push_back(0);
+}
+
+void StreamingValidator::addTerritory(int continentId) {
+    continentEdges.add();
+    continentIds.push_back(continentId);
+    assigned.resize(continentIds.size());
+    if (continentId >= 0)
+        ++continentSizes[continentId];
+    else
+        allInContinents = false;
+}
+
+void StreamingValidator::addMembership(int territoryId) {
+    if (assigned.testAndSet(territoryId))
+        uniqueMembership = false;
+}
+
+void StreamingValidator::addEdge(int fromId, int toId) {
+    int fromContinent = continentIds[fromId];
+    int toContinent = continentIds[toId];
+    if (fromContinent >= 0 && fromContinent == toContinent) {
+        if (continentEdges.unite(fromId, toId))
+            ++continentMerges[fromContinent];
+    } else if (fromContinent >= 0 && toContinent >= 0) {
+        if (continentGraph.unite(fromContinent, toContinent))
+            ++continentGraphMerges;
+    }
+    forwardSum += edgeHash(fromId, toId);
+    reverseSum += edgeHash(toId, fromId);
+}
+
+ValidationReport StreamingValidator::finish(const Map &map) {
+    using Clock = std::chrono::steady_clock;
+    Clock::time_point start = Clock::now();
+    ValidationReport report;
+    int territoryCount = static_cast<int>(continentIds.size());
+
+    // 2) all continents are connected subgraphs
+    Clock::time_point checkStart = Clock::now();
+    std::vector<int> componentCounts(continentSizes.size());
+    bool allConnected = true;
+    for (size_t c = 0; c < continentSizes.size(); ++c) {
+        componentCounts[c] = continentSizes[c] - continentMerges[c];
+        allConnected = allConnected && componentCounts[c] == 1;
+    }
+    if (!allConnected)
+        map.collectSplitContinents(continentEdges, componentCounts,
+                                   report.disconnectedContinents);
+    report.continentsConnected.passed = allConnected;
+    report.continentsConnected.elapsedMs = elapsedMs(checkStart);
+
+    // 1) the map is a connected graph
+    checkStart = Clock::now();
+    int continentCount = static_cast<int>(continentSizes.size());
+    if (territoryCount == 0) {
+        report.connectedGraph.passed = true;
+    } else if (forwardSum == reverseSum && allConnected && allInContinents) {
+        report.connectedGraph.passed =
+            continentCount - continentGraphMerges == 1;
+    } else {
+        report.connectedGraph.passed = map.isConnectedGraph();
+    }
+    report.connectedGraph.elapsedMs = elapsedMs(checkStart);
+
+    // 3) each territory belongs to one and only one continent
+    report.territoriesInOneContinent.passed = uniqueMembership;
+
+    report.territoryCount = continentIds.size();
+    report.totalMs = elapsedMs(start);
+    return report;
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include "Utils/Bitset.h"
+#include "Utils/UnionFind.h"
+#include <cstdint>
+#include <vector>
+
+class Map;
+struct ValidationReport;
+
+// Decides the three map validation rules while a map is being built, from
+// the territories and edges as they are added, so no traversal is needed
+// afterwards. Territories must be added in ID order.
+//
+// Rule 2 joins the endpoints of intra-continent edges in a union-find; a
+// continent is connected when its territory count minus the unions that
+// merged something is one. Rule 1 then follows from a second, much
+// smaller union-find over continents joined by the edges between them: if
+// every continent is connected, the map is connected exactly when that
+// continent graph is. This only holds when every edge has its reverse,
+// which is checked by summing a hash of every edge and of its reverse (the
+// sums agree, up to a 2^-64 chance, only for a symmetric edge multiset).
+// Maps with one-way edges, split continents or territories outside any
+// continent fall back to a BFS for rule 1.
+class StreamingValidator {
+  private:
+    UnionFind continentEdges; // Over territories, intra-continent edges
+    UnionFind continentGraph; // Over continents, edges between them
+    std::vector<int> continentIds; // Per territory, -1 if none
+    std::vector<int> continentSizes;
+    std::vector<int> continentMerges;
+    int continentGraphMerges = 0;
+    bool allInContinents = true;
+    Bitset assigned; // Territories already placed in a continent
+    bool uniqueMembership = true;
+    uint64_t forwardSum = 0;
+    uint64_t reverseSum = 0;
+
+  public:
+    explicit StreamingValidator(int continentCount = 0);
+
+    // Next continent ID
+    void addContinent();
+    // Next territory ID, in continentId (-1 if in none)
+    void addTerritory(int continentId);
+    // A continent lists a territory; more than one listing breaks rule 3
+    void addMembership(int territoryId);
+    void addEdge(int fromId, int toId);
+
+    // Outcome of the rules for the finished map, with the same content as
+    // map.validateWithReport()
+    ValidationReport finish(const Map &map);
+};
@@ -0,0 +1,144 @@
+#include "TerritoryStore.h"
+
+int TerritoryStore::add(int x, int y) {
+    armies.push_back(0);
+    owners.push_back(-1);
+    xs.push_back(x);
+    ys.push_back(y);
+    continentIds.push_back(-1);
+    return static_cast<int>(armies.size()) - 1;
+}
+
+void TerritoryStore::reserve(size_t count) {
+    armies.reserve(count);
+    owners.reserve(count);
+    xs.reserve(count);
+    ys.reserve(count);
+    continentIds.reserve(count);
+}
+
+Player* TerritoryStore::getOwner(int id) const {
+    int index = owners[id];
+    return index < 0 ? nullptr : ownerTable[index];
+}
+
+// Moves the row between owners, keeping the ownership bitsets and the
+// per-continent counters in step.
+void TerritoryStore::setOwner(int id, Player* player) {
+    int ownerIndex = ownerIndexOf(player);
+    int previous = owners[id];
+    if (previous == ownerIndex)
+        return;
+
+    if (previous >= 0)
+        ownerMasks[previous].reset(id);
+    if (ownerIndex >= 0) {
+        if (ownerMasks[ownerIndex].size() < size())
+            ownerMasks[ownerIndex].resize(size());
+        ownerMasks[ownerIndex].set(id);
+    }
+
+    adjustOwnedCount(previous, continentIds[id], -1);
+    adjustOwnedCount(ownerIndex, continentIds[id], 1);
+    owners[id] = ownerIndex;
+    ++ownershipVersion;
+}
+
+void TerritoryStore::setContinentId(int id, int continentId) {
+    int previous = continentIds[id];
+    if (previous == continentId)
+        return;
+
+    if (previous >= 0)
+        --continentSizes[previous];
+    if (continentId >= 0) {
+        if (continentSizes.size() <= static_cast<size_t>(continentId))
+            continentSizes.resize(continentId + 1, 0);
+        ++continentSizes[continentId];
+    }
+
+    adjustOwnedCount(owners[id], previous, -1);
+    adjustOwnedCount(owners[id], continentId, 1);
+    continentIds[id] = continentId;
+}
+
+void TerritoryStore::adjustOwnedCount(int ownerIndex,
+                                      int continentId,
+                                      int delta) {
+    if (ownerIndex < 0 || continentId < 0)
+        return;
+    if (ownedPerContinent.size() <= static_cast<size_t>(ownerIndex))
+        ownedPerContinent.resize(ownerIndex + 1);
+    std::vector<int> &counts = ownedPerContinent[ownerIndex];
+    if (counts.size() <= static_cast<size_t>(continentId))
+        counts.resize(continentId + 1, 0);
+    counts[continentId] += delta;
+}
+
+int TerritoryStore::getContinentSize(int continentId) const {
+    if (continentId < 0
+        || static_cast<size_t>(continentId) >= continentSizes.size())
+        return 0;
+    return continentSizes[continentId];
+}
+
+const Bitset &TerritoryStore::getOwnedMask(int ownerIndex) const {
+    static const Bitset empty;
+    if (ownerIndex < 0 || static_cast<size_t>(ownerIndex) >= ownerMasks.size())
+        return empty;
+    return ownerMasks[ownerIndex];
+}
+
+// Returns the owner table slot for a player, registering it on first use.
+// Games have a handful of players, so a linear scan beats hashing here.
+int TerritoryStore::ownerIndexOf(Player* player) {
+    if (!player)
+        return -1;
+    for (size_t i = 0; i < ownerTable.size(); ++i) {
+        if (ownerTable[i] == player)
+            return static_cast<int>(i);
+    }
+    ownerTable.push_back(player);
+    ownerMasks.emplace_back(size());
+    return static_cast<int>(ownerTable.size()) - 1;
+}
+
+int TerritoryStore::findOwnerIndex(const Player* player) const {
+    for (size_t i = 0; i < ownerTable.size(); ++i) {
+        if (ownerTable[i] == player)
+            return static_cast<int>(i);
+    }
+    return -1;
+}
+
+// Popcount of the owner's bitset
+int TerritoryStore::countOwnedBy(int ownerIndex) const {
+    return static_cast<int>(getOwnedMask(ownerIndex).count());
+}
+
+int TerritoryStore::countOwnedIn(int ownerIndex, int continentId) const {
+    if (ownerIndex < 0 || continentId < 0
+        || static_cast<size_t>(ownerIndex) >= ownedPerContinent.size())
+        return 0;
+    const std::vector<int> &counts = ownedPerContinent[ownerIndex];
+    if (static_cast<size_t>(continentId) >= counts.size())
+        return 0;
+    return counts[continentId];
+}
+
+// A continent is controlled when the owner's counter reaches its size
+bool TerritoryStore::ownsAllOf(int ownerIndex, int continentId) const {
+    if (ownerIndex < 0)
+        return false;
+    return countOwnedIn(ownerIndex, continentId)
+        == getContinentSize(continentId);
+}
+
+// Branch-free loop over the owner/army columns so the compiler can
+// vectorize it.
+int TerritoryStore::sumArmiesOwnedBy(int ownerIndex) const {
+    int total = 0;
+    for (size_t i = 0; i < owners.size(); ++i)
+        total += owners[i] == ownerIndex ? armies[i] : 0;
+    return total;
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include "Utils/Bitset.h"
+#include <cstddef>
+#include <vector>
+
+// Forward declarations
+class Player;
+
+// Struct-of-arrays storage for per-territory state. Each territory is a row
+// addressed by its dense ID; every column is a contiguous array so army
+// updates are plain stores and whole-board scans stream through memory.
+class TerritoryStore {
+  private:
+    std::vector<int> armies;
+    std::vector<int> owners; // Index into ownerTable, -1 if unowned
+    std::vector<int> xs;
+    std::vector<int> ys;
+    std::vector<int> continentIds; // -1 if not part of a continent
+    std::vector<Player*> ownerTable;
+
+    // Ownership bitsets over territory IDs, one per owner table slot, kept
+    // in step with the owner column. They grow on demand as rows are added.
+    std::vector<Bitset> ownerMasks;
+
+    // Owned-territory counters per (owner, continent) and continent sizes,
+    // adjusted in O(1) whenever a row's owner or continent changes
+    std::vector<std::vector<int>> ownedPerContinent; // [owner][continent]
+    std::vector<int> continentSizes;
+
+    // Bumped on every ownership change so derived caches can tell when they
+    // are stale
+    unsigned long long ownershipVersion = 0;
+
+    void adjustOwnedCount(int ownerIndex, int continentId, int delta);
+
+  public:
+    TerritoryStore() = default;
+
+    // Appends a row and returns its index
+    int add(int x, int y);
+    void reserve(size_t count);
+    size_t size() const { return armies.size(); }
+
+    int getArmies(int id) const { return armies[id]; }
+    void setArmies(int id, int amount) { armies[id] = amount; }
+    void addArmies(int id, int amount) { armies[id] += amount; }
+
+    int getX(int id) const { return xs[id]; }
+    int getY(int id) const { return ys[id]; }
+    void setX(int id, int x) { xs[id] = x; }
+    void setY(int id, int y) { ys[id] = y; }
+
+    int getContinentId(int id) const { return continentIds[id]; }
+    void setContinentId(int id, int continentId);
+    int getContinentSize(int continentId) const;
+
+    // Ownership, stored as a small index into the owner table
+    int getOwnerIndex(int id) const { return owners[id]; }
+    Player* getOwner(int id) const;
+    void setOwner(int id, Player* player);
+    int ownerIndexOf(Player* player);
+    int findOwnerIndex(const Player* player) const; // -1 if never an owner
+    const std::vector<Player*> &getOwnerTable() const { return ownerTable; }
+    const Bitset &getOwnedMask(int ownerIndex) const;
+    unsigned long long getOwnershipVersion() const { return ownershipVersion; }
+
+    // Ownership queries answered from the bitsets and counters
+    int countOwnedBy(int ownerIndex) const;
+    int countOwnedIn(int ownerIndex, int continentId) const;
+    bool ownsAllOf(int ownerIndex, int continentId) const;
+
+    // Raw columns, for bulk copies such as snapshots
+    const std::vector<int> &getArmiesColumn() const { return armies; }
+    const std::vector<int> &getOwnerColumn() const { return owners; }
+
+    // Whole-board scans over the contiguous columns
+    int sumArmiesOwnedBy(int ownerIndex) const;
+};
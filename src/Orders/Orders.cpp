@@ -1,9 +1,13 @@
 #include "Orders.h"
 #include "Cards/Cards.h"
+#include "GameEngine/GameContext.h"
 #include "Player/Player.h"
 #include "PlayerStrategies/PlayerStrategies.h"
+#include "Utils/Log.h"
 #include <algorithm>
+#include <iterator>
 #include <sstream>
+#include <utility>
 
 //---------------------------Order (Base class)-------------------------------
 Order::Order() : issuingPlayer(nullptr), cardType(CardType::UNKNOWN) {}
@@ -13,9 +17,10 @@ const std::string &Order::getEffect() const {
     return effect;
 }
 
-// Set the effect of the order throughout the game (for logging purposes)
-void Order::setEffect(const std::string &effect) {
-    this->effect = effect;
+// Set the effect of the order throughout the game (for logging purposes).
+// Taken by value so the temporaries built by callers are moved, not copied.
+void Order::setEffect(std::string effect) {
+    this->effect = std::move(effect);
 }
 
 Player* Order::getPlayer() {
@@ -114,16 +119,33 @@ void OrdersList::addOrder(Order* order) {
 }
 
 void OrdersList::remove(Order* order) {
+    if (order) {
+        orders.remove(order);
+        retire(order);
+    }
+}
+
+void OrdersList::takeOrders(std::list<Order*> &deploys,
+                            std::list<Order*> &others) {
+    for (auto it = orders.begin(); it != orders.end();) {
+        auto next = std::next(it);
+        if (dynamic_cast<Deploy*>(*it) != nullptr)
+            deploys.splice(deploys.end(), orders, it);
+        it = next;
+    }
+    others.splice(others.end(), orders);
+}
+
+void OrdersList::retire(Order* order) {
     if (order) {
         try {
-            orders.remove(order);
             Player* player = order->getPlayer();
             if (player && order->getCardType() != CardType::UNKNOWN) {
                 player->addCard(new Card(order->getCardType()));
             }
             delete order;
         } catch (const std::exception &e) {
-            std::cerr << "Exception in OrdersList::remove: " << e.what()
+            std::cerr << "Exception in OrdersList::retire: " << e.what()
                       << std::endl;
         }
     }
@@ -206,21 +228,9 @@ void Deploy::execute() {
 }
 
 //---------------------------Advance-------------------------------
-// Static members for negotiation tracking
-std::set<std::pair<Player*, Player*>> negotiatedPairs;
-
-void Advance::addNegotiatedPair(Player* p1, Player* p2) {
-    negotiatedPairs.insert(std::make_pair(p1, p2));
-    negotiatedPairs.insert(std::make_pair(p2, p1));
-}
-
-void Advance::clearNegotiatedPairs() {
-    negotiatedPairs.clear();
-}
-
+// Negotiated pairs live in the attacker's game
 bool Advance::canAttack(Player* attacker, Player* defender) {
-    return negotiatedPairs.find(std::make_pair(attacker, defender))
-        == negotiatedPairs.end();
+    return !attacker->getContext().areNegotiating(attacker, defender);
 }
 
 Advance::Advance(Player* player,
@@ -258,9 +268,7 @@ bool Advance::validate() {
     }
 
     // Territory adjacency
-    auto neighbors = source->getAdjacentTerritories();
-    if (std::find(neighbors.begin(), neighbors.end(), target)
-        == neighbors.end()) {
+    if (!source->isAdjacentTo(target)) {
         setEffect("✗ Advance: Could not execute order."
                   " Target territory not adjacent to source territory.");
         return false;
@@ -311,7 +319,7 @@ void Advance::execute() {
                 CardType cardTypes[] = {CardType::REINFORCEMENT, CardType::BOMB,
                                         CardType::AIRLIFT, CardType::BLOCKADE,
                                         CardType::DIPLOMACY};
-                int randomIndex = rand() % 5;
+                int randomIndex = issuingPlayer->getContext().nextInt(5);
                 Card* rewardCard = new Card(cardTypes[randomIndex]);
                 issuingPlayer->addCard(rewardCard);
                 issuingPlayer->setConqueredTerritoryThisTurn(true);
@@ -329,12 +337,13 @@ void Advance::execute() {
             int defenders = target->getArmies();
 
             // Battle simulation
+            GameContext &game = issuingPlayer->getContext();
             for (int i = 0; i < attackers; i++) {
-                if (rand() % 100 < 60) // 60% chance to kill defender
+                if (game.nextInt(100) < 60) // 60% chance to kill defender
                     defendersKilled++;
             }
             for (int i = 0; i < defenders; i++) {
-                if (rand() % 100 < 70) // 70% chance to kill attacker
+                if (game.nextInt(100) < 70) // 70% chance to kill attacker
                     attackersKilled++;
             }
 
@@ -360,9 +369,10 @@ void Advance::execute() {
                 if (previousOwner && previousOwner->getStrategy()) {
                     if (dynamic_cast<NeutralPlayerStrategy*>(
                             previousOwner->getStrategy())) {
+                        delete previousOwner->getStrategy();
                         previousOwner->setStrategy(
                             new AggressivePlayerStrategy());
-                        std::cout << "Neutral player "
+                        LOG_TRACE << "Neutral player "
                                   << previousOwner->getName()
                                   << " was attacked and became Aggressive!"
                                   << std::endl;
@@ -374,7 +384,7 @@ void Advance::execute() {
                                             CardType::BOMB, CardType::AIRLIFT,
                                             CardType::BLOCKADE,
                                             CardType::DIPLOMACY};
-                    int randomIndex = rand() % 5;
+                    int randomIndex = issuingPlayer->getContext().nextInt(5);
                     Card* rewardCard = new Card(cardTypes[randomIndex]);
 
                     issuingPlayer->addCard(rewardCard);
@@ -429,9 +439,7 @@ bool Bomb::validate() {
     // Target must be adjacent to a player's territory
     bool isAdjacent = false;
     for (Territory* territory : issuingPlayer->getTerritories()) {
-        auto neighbors = territory->getAdjacentTerritories();
-        if (std::find(neighbors.begin(), neighbors.end(), target)
-            != neighbors.end()) {
+        if (territory->isAdjacentTo(target)) {
             isAdjacent = true;
             break;
         }
@@ -458,15 +466,6 @@ void Bomb::execute() {
 }
 
 //---------------------------Blockade-------------------------------
-Player* Blockade::neutralPlayer = nullptr;
-
-Player* Blockade::getNeutralPlayer() {
-    if (!neutralPlayer) {
-        neutralPlayer = new Player("Neutral");
-    }
-    return neutralPlayer;
-}
-
 Blockade::Blockade(Player* player, Territory* target) : target(target) {
     description = "Blockade " + target->getName();
     cardType = CardType::BLOCKADE;
@@ -504,11 +503,12 @@ void Blockade::execute() {
         int newArmies = currentArmies * 2;
         target->setArmies(newArmies);
         Player* previousOwner = target->getPlayer();
-        target->setPlayer(getNeutralPlayer());
+        Player* neutralPlayer = issuingPlayer->getContext().getNeutralPlayer();
+        target->setPlayer(neutralPlayer);
 
         // Remove territory from previous owner and add to neutral
         previousOwner->removeTerritory(target);
-        getNeutralPlayer()->addTerritory(target);
+        neutralPlayer->addTerritory(target);
 
         setEffect("✓ Blockade: Applied on " + target->getName()
                   + ": Armies doubled from " + std::to_string(currentArmies)
@@ -613,7 +613,8 @@ bool Negotiate::validate() {
 void Negotiate::execute() {
     if (validate()) {
         // Establish peace between players for this turn
-        Advance::addNegotiatedPair(issuingPlayer, targetPlayer);
+        issuingPlayer->getContext().addNegotiatedPair(issuingPlayer,
+                                                      targetPlayer);
         setEffect(
             "✓ Negotiate: Peace treaty established between "
             + issuingPlayer->getName() + " and " + targetPlayer->getName()
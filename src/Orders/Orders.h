@@ -44,7 +44,7 @@ class Order : public ILoggable, public Subject {
     CardType cardType;     // Type of card that made the order
 
     // Set the effect after execution
-    void setEffect(const std::string &effect);
+    void setEffect(std::string effect);
     void setCurrentState(const std::string &currentState);
 
     std::string description;  // Description of the order
@@ -69,6 +69,14 @@ class OrdersList : public ILoggable, public Subject {
     void remove(Order* order);
     bool move(Order* order, int newPosition);
 
+    // Empties the list in one pass: Deploy orders go to deploys and the
+    // rest to others, each in the order they were issued. Nodes are
+    // spliced, not copied.
+    void takeOrders(std::list<Order*> &deploys, std::list<Order*> &others);
+    // What remove() does once an order is out of the list: returns the
+    // order's card to its player and deletes the order
+    void retire(Order* order);
+
     // Logging method
     std::string stringToLog() override;
 
@@ -110,10 +118,6 @@ class Advance : public Order {
     bool validate() override;
     void execute() override;
     std::string stringToLog() override;
-
-    // Static method to track negotiated pairs
-    static void addNegotiatedPair(Player* p1, Player* p2);
-    static void clearNegotiatedPairs();
 };
 
 // Bomb concrete order
@@ -132,16 +136,12 @@ class Bomb : public Order {
 class Blockade : public Order {
   private:
     Territory* target;
-    static Player* neutralPlayer; // Singleton neutral player
 
   public:
     Blockade(Player* player, Territory* target);
     bool validate() override;
     void execute() override;
     std::string stringToLog() override;
-
-    // Static method to get/create neutral player
-    static Player* getNeutralPlayer();
 };
 
 // Airlift concrete order
@@ -1,4 +1,5 @@
 #include "OrdersDriver.h"
+#include "GameEngine/GameContext.h"
 #include "Map/Map.h"
 #include "Orders.h"
 #include "Player/Player.h"
@@ -134,7 +135,7 @@ void testOrderExecution() {
     std::cout << "\nAfter blockade:" << std::endl;
     std::cout << "Armies in T2: " << t2->getArmies() << std::endl;
     std::cout << "Owner of T2: "
-              << (t2->getPlayer() == Blockade::getNeutralPlayer()
+              << (t2->getPlayer() == p1->getContext().getNeutralPlayer()
                       ? "Neutral"
                       : "Not Neutral")
               << std::endl;
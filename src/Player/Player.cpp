@@ -1,4 +1,5 @@
 #include "Player.h"
+#include "GameEngine/GameContext.h"
 #include "PlayerStrategies/PlayerStrategies.h"
 #include <algorithm>
 #include <iostream>
@@ -23,7 +24,8 @@ Player::Player(const Player &copiedPlayer)
       reinforcementPool(new int(*copiedPlayer.reinforcementPool)),
       availableReinforcementPool(copiedPlayer.availableReinforcementPool),
       strategy(copiedPlayer.strategy),
-      hasCheatedThisTurn(copiedPlayer.hasCheatedThisTurn) {
+      hasCheatedThisTurn(copiedPlayer.hasCheatedThisTurn),
+      context(copiedPlayer.context) {
     // Deep copy ordersList if present
     if (copiedPlayer.ordersList) {
         ordersList = new OrdersList(*copiedPlayer.ordersList);
@@ -43,6 +45,7 @@ Player &Player::operator=(const Player &other) {
         availableReinforcementPool = other.availableReinforcementPool;
         strategy = other.strategy;
         hasCheatedThisTurn = other.hasCheatedThisTurn;
+        context = other.context;
         // Deep copy other's ordersList
         if (ordersList) {
             delete ordersList;
@@ -142,6 +145,10 @@ void Player::issueAdvanceOrder(Territory* from, Territory* to, int numArmies) {
     addOrder(advanceOrder);
 }
 
+GameContext &Player::getContext() const {
+    return context ? *context : GameContext::shared();
+}
+
 const std::string &Player::getName() const {
     return *name;
 }
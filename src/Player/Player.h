@@ -13,6 +13,7 @@ class Deck;
 class OrdersList;
 class PlayerStrategy;
 class HumanPlayerStrategy;
+class GameContext;
 
 // A player in the game
 class Player {
@@ -26,6 +27,7 @@ class Player {
     bool hasReceivedCardThisTurn = false;
     PlayerStrategy* strategy;        // Strategy for behavior
     bool hasCheatedThisTurn = false; // For Cheater strategy
+    GameContext* context = nullptr;  // Game this player is part of
 
   public:
     bool hasConqueredTerritoryThisTurn() const {
@@ -74,6 +76,11 @@ class Player {
     bool getHasCheatedThisTurn() const { return hasCheatedThisTurn; }
     void setHasCheatedThisTurn(bool value) { hasCheatedThisTurn = value; }
 
+    // Per-game state shared with the other players of the same game; a
+    // player outside any game engine uses GameContext::shared()
+    void setContext(GameContext* gameContext) { context = gameContext; }
+    GameContext &getContext() const;
+
     // Getters
     const std::string &getName() const;
     OrdersList* getOrdersList() const;
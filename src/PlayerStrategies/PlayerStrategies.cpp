@@ -1,22 +1,39 @@
 #include "PlayerStrategies.h"
 #include "Cards/Cards.h"
 #include "Orders/Orders.h"
+#include "Utils/Log.h"
 #include <algorithm>
 #include <iostream>
 #include <limits>
 
 // Helper function to check if two territories are adjacent
 bool areAdjacent(Territory* t1, Territory* t2) {
-    const auto &neighbors = t1->getAdjacentTerritories();
-    return std::find(neighbors.begin(), neighbors.end(), t2) != neighbors.end();
+    return t1->isAdjacentTo(t2);
 }
 
-// Helper function to get enemy territories adjacent to player's territories
+// Helper function to get the hop count from a territory to the nearest
+// territory held by someone else, INT_MAX if there is none
+int distanceToNearestEnemy(Territory* territory) {
+    Map* map = territory->getMap();
+    int distance = map ? map->distanceToNearestEnemy(territory)
+                       : Map::Unreachable;
+    return distance == Map::Unreachable
+        ? std::numeric_limits<int>::max()
+        : distance;
+}
+
+// Helper function to get enemy territories adjacent to player's territories.
+// Territories on a map are served from the map's incrementally maintained
+// frontier; standalone territories fall back to scanning every edge.
 std::vector<Territory*> getAdjacentEnemyTerritories(Player* player) {
+    const std::vector<Territory*> &owned = player->getTerritories();
+    if (!owned.empty() && owned.front()->getMap())
+        return owned.front()->getMap()->getEnemyFrontier(player);
+
     std::vector<Territory*> enemyTerritories;
     std::set<Territory*> uniqueEnemies;
 
-    for (Territory* territory : player->getTerritories()) {
+    for (Territory* territory : owned) {
         for (Territory* neighbor : territory->getAdjacentTerritories()) {
             if (neighbor->getPlayer() != player) {
                 uniqueEnemies.insert(neighbor);
@@ -410,7 +427,7 @@ std::vector<Territory*> HumanPlayerStrategy::toAttack(Player* player) {
 
 //---------------------------AggressiveStrategy--------------------------
 void AggressivePlayerStrategy::issueOrder(Player* player, Deck* deck) {
-    std::cout << "\n[Aggressive Player " << player->getName()
+    LOG_TRACE << "\n[Aggressive Player " << player->getName()
               << " issuing orders]" << std::endl;
 
     // Get territory lists once
@@ -428,7 +445,7 @@ void AggressivePlayerStrategy::issueOrder(Player* player, Deck* deck) {
             Deploy* deployOrder = new Deploy(player, strongest, armiesToDeploy);
             player->addOrder(deployOrder);
             player->decrementAvailableReinforcementPool(armiesToDeploy);
-            std::cout << "✓ Deployed " << armiesToDeploy << " armies to "
+            LOG_TRACE << "✓ Deployed " << armiesToDeploy << " armies to "
                       << strongest->getName() << std::endl;
         }
     }
@@ -441,7 +458,7 @@ void AggressivePlayerStrategy::issueOrder(Player* player, Deck* deck) {
         if (type == CardType::BOMB && !attackList.empty()) {
             // Bomb the weakest enemy territory
             cardOrder = new Bomb(player, attackList.front());
-            std::cout << "✓ Playing BOMB card on "
+            LOG_TRACE << "✓ Playing BOMB card on "
                       << attackList.front()->getName() << std::endl;
         } else if (type == CardType::AIRLIFT && defendList.size() >= 2
                    && !attackList.empty()) {
@@ -451,7 +468,7 @@ void AggressivePlayerStrategy::issueOrder(Player* player, Deck* deck) {
             int armies = source->getArmies() / 2;   // Move half
             if (armies > 0) {
                 cardOrder = new Airlift(player, source, dest, armies);
-                std::cout << "✓ Playing AIRLIFT card: " << armies
+                LOG_TRACE << "✓ Playing AIRLIFT card: " << armies
                           << " armies from " << source->getName() << " to "
                           << dest->getName() << std::endl;
             }
@@ -481,7 +498,7 @@ void AggressivePlayerStrategy::issueOrder(Player* player, Deck* deck) {
 
         if (armies > 0) {
             player->issueAdvanceOrder(source, target, armies);
-            std::cout << "✓ Issued advance order to attack "
+            LOG_TRACE << "✓ Issued advance order to attack "
                       << target->getName() << " with " << armies << " armies"
                       << std::endl;
         }
@@ -514,7 +531,7 @@ std::vector<Territory*> AggressivePlayerStrategy::toAttack(Player* player) {
 
 //---------------------------BenevolentStrategy--------------------------
 void BenevolentPlayerStrategy::issueOrder(Player* player, Deck* deck) {
-    std::cout << "\n[Benevolent Player " << player->getName()
+    LOG_TRACE << "\n[Benevolent Player " << player->getName()
               << " issuing orders]" << std::endl;
 
     // Deploy all reinforcements to weakest territory
@@ -527,7 +544,7 @@ void BenevolentPlayerStrategy::issueOrder(Player* player, Deck* deck) {
             Deploy* deployOrder = new Deploy(player, weakest, armiesToDeploy);
             player->addOrder(deployOrder);
             player->decrementAvailableReinforcementPool(armiesToDeploy);
-            std::cout << "✓ Deployed " << armiesToDeploy << " armies to "
+            LOG_TRACE << "✓ Deployed " << armiesToDeploy << " armies to "
                       << weakest->getName() << std::endl;
         }
     }
@@ -545,15 +562,20 @@ void BenevolentPlayerStrategy::issueOrder(Player* player, Deck* deck) {
             player->setReinforcementPool(player->getReinforcementPool() + 5);
             player->removeCard(card);
             deck->returnCard(card);
-            std::cout << "✓ Played REINFORCEMENT card: +5 armies to pool (now "
+            LOG_TRACE << "✓ Played REINFORCEMENT card: +5 armies to pool (now "
                       << player->getReinforcementPool() << ")" << std::endl;
             break;
         } else if (type == CardType::DIPLOMACY && !attackList.empty()) {
-            // Negotiate with the strongest enemy player
-            std::set<Player*> enemyPlayers;
+            // Negotiate with the strongest enemy player. Enemies are kept in
+            // the order they border us, not by address, so ties resolve the
+            // same way in a replayed game.
+            std::vector<Player*> enemyPlayers;
             for (Territory* t : attackList) {
-                if (t->getPlayer() != player) {
-                    enemyPlayers.insert(t->getPlayer());
+                if (t->getPlayer() != player
+                    && std::find(enemyPlayers.begin(), enemyPlayers.end(),
+                                 t->getPlayer())
+                           == enemyPlayers.end()) {
+                    enemyPlayers.push_back(t->getPlayer());
                 }
             }
             if (!enemyPlayers.empty()) {
@@ -565,7 +587,7 @@ void BenevolentPlayerStrategy::issueOrder(Player* player, Deck* deck) {
                                               < b->getTerritories().size();
                                       });
                 cardOrder = new Negotiate(player, targetPlayer);
-                std::cout << "✓ Playing DIPLOMACY card with "
+                LOG_TRACE << "✓ Playing DIPLOMACY card with "
                           << targetPlayer->getName() << std::endl;
             }
         }
@@ -587,7 +609,7 @@ void BenevolentPlayerStrategy::issueOrder(Player* player, Deck* deck) {
             (source->getArmies() - 1) / 2; // Move half, leave some behind
         if (armies > 0 && areAdjacent(source, dest)) {
             player->issueAdvanceOrder(source, dest, armies);
-            std::cout << "✓ Moved " << armies << " armies from "
+            LOG_TRACE << "✓ Moved " << armies << " armies from "
                       << source->getName() << " to " << dest->getName()
                       << std::endl;
         }
@@ -597,10 +619,13 @@ void BenevolentPlayerStrategy::issueOrder(Player* player, Deck* deck) {
 std::vector<Territory*> BenevolentPlayerStrategy::toDefend(Player* player) {
     std::vector<Territory*> toDefendList = player->getTerritories();
 
-    // Sort by number of armies (weakest first)
+    // Sort by number of armies (weakest first), ties going to the territory
+    // closest to an enemy
     std::sort(toDefendList.begin(), toDefendList.end(),
               [](Territory* a, Territory* b) {
-                  return a->getArmies() < b->getArmies();
+                  if (a->getArmies() != b->getArmies())
+                      return a->getArmies() < b->getArmies();
+                  return distanceToNearestEnemy(a) < distanceToNearestEnemy(b);
               });
 
     return toDefendList;
@@ -615,7 +640,7 @@ BenevolentPlayerStrategy::toAttack([[maybe_unused]] Player* player) {
 //---------------------------NeutralStrategy-----------------------------
 void NeutralPlayerStrategy::issueOrder(Player* player,
                                        [[maybe_unused]] Deck* deck) {
-    std::cout << "\n[Neutral Player " << player->getName()
+    LOG_TRACE << "\n[Neutral Player " << player->getName()
               << " issuing orders - does nothing]" << std::endl;
     // Neutral players issue no orders and play no cards
 }
@@ -632,7 +657,7 @@ NeutralPlayerStrategy::toAttack([[maybe_unused]] Player* player) {
 //---------------------------CheaterStrategy-----------------------------
 void CheaterPlayerStrategy::issueOrder(Player* player,
                                        [[maybe_unused]] Deck* deck) {
-    std::cout << "\n[Cheater Player " << player->getName() << " issuing orders]"
+    LOG_TRACE << "\n[Cheater Player " << player->getName() << " issuing orders]"
               << std::endl;
 
     // Conquer all adjacent enemy territories once per turn
@@ -646,12 +671,12 @@ void CheaterPlayerStrategy::issueOrder(Player* player,
             target->setPlayer(player);
             target->setArmies(1); // Set to 1 army
             player->addTerritory(target);
-            std::cout << "✓ Cheated: Conquered " << target->getName()
+            LOG_TRACE << "✓ Cheated: Conquered " << target->getName()
                       << std::endl;
         }
         player->setHasCheatedThisTurn(true);
     } else {
-        std::cout << "✓ Already cheated this turn" << std::endl;
+        LOG_TRACE << "✓ Already cheated this turn" << std::endl;
     }
 
     // Cheater doesn't play cards
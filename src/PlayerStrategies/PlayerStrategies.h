@@ -15,6 +15,8 @@ class PlayerStrategy {
     virtual void issueOrder(Player* player, Deck* deck) = 0;
     virtual std::vector<Territory*> toDefend(Player* player) = 0;
     virtual std::vector<Territory*> toAttack(Player* player) = 0;
+    // Name used by the tournament command's -P list and in profiles
+    virtual const char* getName() const = 0;
 };
 
 // Human player strategy - requires user interaction
@@ -23,6 +25,7 @@ class HumanPlayerStrategy : public PlayerStrategy {
     void issueOrder(Player* player, Deck* deck) override;
     std::vector<Territory*> toDefend(Player* player) override;
     std::vector<Territory*> toAttack(Player* player) override;
+    const char* getName() const override { return "Human"; }
 };
 
 // Aggressive player strategy - deploy to strongest, then always attack
@@ -31,6 +34,7 @@ class AggressivePlayerStrategy : public PlayerStrategy {
     void issueOrder(Player* player, Deck* deck) override;
     std::vector<Territory*> toDefend(Player* player) override;
     std::vector<Territory*> toAttack(Player* player) override;
+    const char* getName() const override { return "Aggressive"; }
 };
 
 // Benevolent player strategy - deploy/advance to weakest territories
@@ -39,6 +43,7 @@ class BenevolentPlayerStrategy : public PlayerStrategy {
     void issueOrder(Player* player, Deck* deck) override;
     std::vector<Territory*> toDefend(Player* player) override;
     std::vector<Territory*> toAttack(Player* player) override;
+    const char* getName() const override { return "Benevolent"; }
 };
 
 // Neutral player strategy - never issues orders - aggressive if attacked
@@ -47,6 +52,7 @@ class NeutralPlayerStrategy : public PlayerStrategy {
     void issueOrder(Player* player, Deck* deck) override;
     std::vector<Territory*> toDefend(Player* player) override;
     std::vector<Territory*> toAttack(Player* player) override;
+    const char* getName() const override { return "Neutral"; }
 };
 
 // Cheater player strategy - conquers all adjacent territories
@@ -55,4 +61,5 @@ class CheaterPlayerStrategy : public PlayerStrategy {
     void issueOrder(Player* player, Deck* deck) override;
     std::vector<Territory*> toDefend(Player* player) override;
     std::vector<Territory*> toAttack(Player* player) override;
+    const char* getName() const override { return "Cheater"; }
 };
\ No newline at end of file
@@ -0,0 +1,52 @@
+#include "Bitset.h"
+#include <algorithm>
+#include <bitset>
+
+Bitset::Bitset() : bitCount(0) {}
+
+Bitset::Bitset(size_t size) : words((size + 63) / 64, 0), bitCount(size) {}
+
+void Bitset::resize(size_t size) {
+    words.resize((size + 63) / 64, 0);
+    bitCount = size;
+    // Drop bits beyond the new size so count() stays exact
+    if (size % 64 != 0)
+        words.back() &= (uint64_t(1) << (size % 64)) - 1;
+}
+
+void Bitset::clear() {
+    std::fill(words.begin(), words.end(), 0);
+}
+
+bool Bitset::testAndSet(size_t i) {
+    uint64_t mask = uint64_t(1) << (i & 63);
+    bool wasSet = (words[i >> 6] & mask) != 0;
+    words[i >> 6] |= mask;
+    return wasSet;
+}
+
+bool Bitset::containsAll(const Bitset &mask) const {
+    const std::vector<uint64_t> &other = mask.words;
+    for (size_t i = 0; i < other.size(); ++i) {
+        uint64_t own = i < words.size() ? words[i] : 0;
+        if ((other[i] & ~own) != 0)
+            return false;
+    }
+    return true;
+}
+
+// std::bitset::count lowers to a hardware popcount where available
+size_t Bitset::count() const {
+    size_t total = 0;
+    for (uint64_t word : words)
+        total += std::bitset<64>(word).count();
+    return total;
+}
+
+bool Bitset::none() const {
+    for (uint64_t word : words) {
+        if (word != 0)
+            return false;
+    }
+    return true;
+}
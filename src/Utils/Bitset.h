@@ -0,0 +1,37 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Dense bitset sized at runtime, packed into 64-bit words
+class Bitset {
+  private:
+    std::vector<uint64_t> words;
+    size_t bitCount;
+
+  public:
+    Bitset();
+    explicit Bitset(size_t size);
+
+    void resize(size_t size);
+    void clear(); // Resets every bit, keeps the size
+    size_t size() const { return bitCount; }
+
+    bool test(size_t i) const { return (words[i >> 6] >> (i & 63)) & 1u; }
+    void set(size_t i) { words[i >> 6] |= uint64_t(1) << (i & 63); }
+    void reset(size_t i) { words[i >> 6] &= ~(uint64_t(1) << (i & 63)); }
+
+    // Sets bit i and returns whether it was already set
+    bool testAndSet(size_t i);
+
+    // True if every bit set in mask is also set here. Words past either
+    // bitset's end count as zero, so sizes need not match.
+    bool containsAll(const Bitset &mask) const;
+
+    // Population count
+    size_t count() const;
+    bool all() const { return count() == bitCount; }
+    bool none() const;
+
+    const std::vector<uint64_t> &getWords() const { return words; }
+};
@@ -0,0 +1,39 @@
+#include "Log.h"
+
+std::atomic<int> Log::threshold{static_cast<int>(Log::CompiledLevel)};
+thread_local std::ostream* Log::sink = nullptr;
+
+void Log::setLevel(LogLevel level) {
+    threshold.store(static_cast<int>(level), std::memory_order_relaxed);
+}
+
+LogLevel Log::getLevel() {
+    return static_cast<LogLevel>(threshold.load(std::memory_order_relaxed));
+}
+
+bool Log::parseLevel(const std::string &name, LogLevel &level) {
+    for (LogLevel candidate : {LogLevel::Trace, LogLevel::Debug, LogLevel::Info,
+                               LogLevel::Result, LogLevel::Off}) {
+        if (name == levelName(candidate)) {
+            level = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+const char* Log::levelName(LogLevel level) {
+    switch (level) {
+        case LogLevel::Trace:
+            return "trace";
+        case LogLevel::Debug:
+            return "debug";
+        case LogLevel::Info:
+            return "info";
+        case LogLevel::Result:
+            return "result";
+        case LogLevel::Off:
+            return "off";
+    }
+    return "unknown";
+}
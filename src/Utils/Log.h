@@ -0,0 +1,87 @@
+#pragma once
+#include <atomic>
+#include <iostream>
+#include <string>
+
+// Importance of a line of game output, least important first:
+//   Trace  - per-order effects, strategy decisions, reinforcement breakdowns
+//   Debug  - turn and phase banners, setup progress
+//   Info   - command feedback and progress a player at the console expects
+//   Result - outcomes such as the tournament results table
+enum class LogLevel { Trace, Debug, Info, Result, Off };
+
+// Lowest level compiled in. WARZONE_HEADLESS builds keep only results; any
+// build can pick its own floor with -DWARZONE_MIN_LOG_LEVEL=Info and so on.
+#ifndef WARZONE_MIN_LOG_LEVEL
+#ifdef WARZONE_HEADLESS
+#define WARZONE_MIN_LOG_LEVEL Result
+#else
+#define WARZONE_MIN_LOG_LEVEL Trace
+#endif
+#endif
+
+// Runtime threshold for game output, shared by every thread, and where
+// each thread's lines go
+class Log {
+  private:
+    static std::atomic<int> threshold;
+    static thread_local std::ostream* sink; // nullptr: std::cout
+
+    friend class LogCapture;
+
+  public:
+    static constexpr LogLevel CompiledLevel = LogLevel::WARZONE_MIN_LOG_LEVEL;
+
+    // Lines below level are dropped; the default shows everything compiled
+    static void setLevel(LogLevel level);
+    static LogLevel getLevel();
+    static bool isEnabled(LogLevel level) {
+        return level >= CompiledLevel
+            && static_cast<int>(level)
+            >= threshold.load(std::memory_order_relaxed);
+    }
+
+    // "trace", "debug", "info", "result" or "off"; false if unknown
+    static bool parseLevel(const std::string &name, LogLevel &level);
+    static const char* levelName(LogLevel level);
+
+    // The calling thread's output: std::cout unless a LogCapture is active
+    static std::ostream &stream() { return sink ? *sink : std::cout; }
+};
+
+// Sends the calling thread's log lines to buffer until destroyed, e.g. so
+// a game played on a worker thread can be printed after the one before it.
+// Captures nest; the previous destination is restored.
+class LogCapture {
+  private:
+    std::ostream* previous;
+
+  public:
+    explicit LogCapture(std::ostream &buffer) : previous(Log::sink) {
+        Log::sink = &buffer;
+    }
+    ~LogCapture() { Log::sink = previous; }
+    LogCapture(const LogCapture &) = delete;
+    LogCapture &operator=(const LogCapture &) = delete;
+};
+
+// Takes the finished stream expression so WARZONE_LOG stays one expression
+// (safe under an unbraced if/else)
+struct LogVoidify {
+    void operator&(std::ostream &) const {}
+};
+
+// Streams to Log::stream() when the level is enabled, e.g.
+//   LOG_DEBUG << "=== Turn " << turn << " ===" << std::endl;
+// The operands are only evaluated when the line is printed. Levels below
+// the compiled floor fail a constant test, so the compiler drops the whole
+// statement.
+#define WARZONE_LOG(level)                                                     \
+    (LogLevel::level < Log::CompiledLevel || !Log::isEnabled(LogLevel::level)) \
+        ? (void)0                                                              \
+        : LogVoidify() & Log::stream()
+
+#define LOG_TRACE WARZONE_LOG(Trace)
+#define LOG_DEBUG WARZONE_LOG(Debug)
+#define LOG_INFO WARZONE_LOG(Info)
+#define LOG_RESULT WARZONE_LOG(Result)
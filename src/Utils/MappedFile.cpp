@@ -0,0 +1,51 @@
+#include "MappedFile.h"
+#include <fstream>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile(const std::string &path) {
+#ifndef _WIN32
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return;
+    struct stat info;
+    if (::fstat(fd, &info) == 0) {
+        opened = true;
+        length = static_cast<size_t>(info.st_size);
+        if (length > 0) {
+            void* address = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (address != MAP_FAILED) {
+                // The parser reads front to back
+                ::madvise(address, length, MADV_SEQUENTIAL);
+                bytes = static_cast<const char*>(address);
+                mapped = true;
+            }
+        }
+    }
+    ::close(fd);
+    if (mapped || !opened || length == 0)
+        return;
+    opened = false; // mmap failed: fall back to reading
+#endif
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file)
+        return;
+    buffer.resize(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    bytes = buffer.data();
+    length = buffer.size();
+    opened = true;
+}
+
+MappedFile::~MappedFile() {
+#ifndef _WIN32
+    if (mapped)
+        ::munmap(const_cast<char*>(bytes), length);
+#endif
+}
@@ -0,0 +1,64 @@
+#include "Profiler.h"
+#include <algorithm>
+
+std::atomic<bool> Profiler::enabled{false};
+
+void Profiler::setEnabled(bool on) {
+    enabled.store(on, std::memory_order_relaxed);
+}
+
+// Values 0-3 get a bucket each; above that, [2^e, 2^(e+1)) is split into
+// four buckets by the two bits below the leading one
+int Histogram::bucketOf(uint64_t nanoseconds) {
+    if (nanoseconds < 4)
+        return static_cast<int>(nanoseconds);
+    int exponent = 2;
+    while (nanoseconds >> (exponent + 1))
+        ++exponent;
+    int quarter = static_cast<int>((nanoseconds >> (exponent - 2)) & 3);
+    return 4 + (exponent - 2) * 4 + quarter;
+}
+
+uint64_t Histogram::bucketUpperBound(int bucket) {
+    if (bucket < 4)
+        return static_cast<uint64_t>(bucket);
+    int exponent = (bucket - 4) / 4 + 2;
+    uint64_t quarter = static_cast<uint64_t>((bucket - 4) % 4);
+    uint64_t step = uint64_t(1) << (exponent - 2);
+    return (uint64_t(1) << exponent) + (quarter + 1) * step - 1;
+}
+
+void Histogram::record(uint64_t nanoseconds) {
+    ++buckets[bucketOf(nanoseconds)];
+    ++count;
+    total += nanoseconds;
+    min = std::min(min, nanoseconds);
+    max = std::max(max, nanoseconds);
+}
+
+void Histogram::merge(const Histogram &other) {
+    for (int b = 0; b < BucketCount; ++b)
+        buckets[b] += other.buckets[b];
+    count += other.count;
+    total += other.total;
+    min = std::min(min, other.min);
+    max = std::max(max, other.max);
+}
+
+void Histogram::clear() {
+    *this = Histogram();
+}
+
+uint64_t Histogram::percentile(double fraction) const {
+    if (count == 0)
+        return 0;
+    // Rank of the wanted sample, 1-based
+    uint64_t rank = static_cast<uint64_t>(fraction * double(count - 1)) + 1;
+    uint64_t seen = 0;
+    for (int b = 0; b < BucketCount; ++b) {
+        seen += buckets[b];
+        if (seen >= rank)
+            return std::clamp(bucketUpperBound(b), getMin(), max);
+    }
+    return max;
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+// Distribution of durations in nanoseconds. Buckets split every power of
+// two into four, so a percentile is within 25% of the exact value; count,
+// total, min and max are exact.
+class Histogram {
+  public:
+    static constexpr int BucketCount = 252;
+
+    void record(uint64_t nanoseconds);
+    void merge(const Histogram &other);
+    void clear();
+
+    uint64_t getCount() const { return count; }
+    uint64_t getTotal() const { return total; }
+    uint64_t getMin() const { return count ? min : 0; }
+    uint64_t getMax() const { return max; }
+    double getMean() const { return count ? double(total) / count : 0.0; }
+    // Upper end of the bucket holding the given fraction (0.5 = median)
+    uint64_t percentile(double fraction) const;
+
+  private:
+    std::array<uint64_t, BucketCount> buckets{};
+    uint64_t count = 0;
+    uint64_t total = 0;
+    uint64_t min = UINT64_MAX;
+    uint64_t max = 0;
+
+    static int bucketOf(uint64_t nanoseconds);
+    static uint64_t bucketUpperBound(int bucket);
+};
+
+// Process-wide switch for ScopedTimer; off by default
+class Profiler {
+  private:
+    static std::atomic<bool> enabled;
+
+  public:
+    static void setEnabled(bool on);
+    static bool isEnabled() { return enabled.load(std::memory_order_relaxed); }
+};
+
+// Records the time from construction to destruction into a histogram.
+// While profiling is off it reads no clock, e.g.
+//   { ScopedTimer timer(profile.phase(TurnPhase::IssueOrders)); ... }
+class ScopedTimer {
+  private:
+    Histogram* target;
+    std::chrono::steady_clock::time_point start;
+
+  public:
+    explicit ScopedTimer(Histogram &histogram)
+        : target(Profiler::isEnabled() ? &histogram : nullptr) {
+        if (target)
+            start = std::chrono::steady_clock::now();
+    }
+    ~ScopedTimer() {
+        if (target)
+            target->record(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                               std::chrono::steady_clock::now() - start)
+                               .count());
+    }
+    ScopedTimer(const ScopedTimer &) = delete;
+    ScopedTimer &operator=(const ScopedTimer &) = delete;
+};
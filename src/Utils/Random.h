@@ -0,0 +1,37 @@
+#pragma once
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+// Random draws built only on an engine's raw output. The standard engines
+// produce the same sequence everywhere, but std::shuffle and the
+// distributions are left to each standard library, so seeded games use
+// these instead to replay the same on any platform.
+
+// Uniform in [0, bound), 0 < bound <= Engine::max(). Rejects the few raw
+// values above the last whole multiple of bound, so no result is favoured.
+template <typename Engine>
+typename Engine::result_type
+randomBelow(Engine &engine, typename Engine::result_type bound) {
+    using Result = typename Engine::result_type;
+    static_assert(Engine::min() == 0, "randomBelow needs an engine from 0");
+    // (max + 1) % bound, without overflowing when max fills Result
+    Result excess = (Engine::max() % bound + 1) % bound;
+    Result limit = Engine::max() - excess;
+    while (true) {
+        Result value = engine();
+        if (value <= limit)
+            return value % bound;
+    }
+}
+
+// Fisher-Yates shuffle
+template <typename T, typename Engine>
+void randomShuffle(std::vector<T> &items, Engine &engine) {
+    using Result = typename Engine::result_type;
+    for (size_t i = items.size(); i > 1; --i) {
+        size_t j = static_cast<size_t>(
+            randomBelow(engine, static_cast<Result>(i)));
+        std::swap(items[i - 1], items[j]);
+    }
+}
@@ -0,0 +1,44 @@
+#include "SparseSet.h"
+
+SparseSet::SparseSet(size_t universe) : positions(universe, -1) {}
+
+void SparseSet::resize(size_t universe) {
+    if (universe < positions.size()) {
+        for (size_t i = universe; i < positions.size(); ++i) {
+            if (positions[i] >= 0)
+                erase(static_cast<int>(i));
+        }
+    }
+    positions.resize(universe, -1);
+}
+
+void SparseSet::clear() {
+    for (int value : members)
+        positions[value] = -1;
+    members.clear();
+}
+
+void SparseSet::insert(int value) {
+    if (positions[value] >= 0)
+        return;
+    positions[value] = static_cast<int>(members.size());
+    members.push_back(value);
+}
+
+void SparseSet::erase(int value) {
+    int position = positions[value];
+    if (position < 0)
+        return;
+    int last = members.back();
+    members[position] = last;
+    positions[last] = position;
+    members.pop_back();
+    positions[value] = -1;
+}
+
+void SparseSet::assign(int value, bool present) {
+    if (present)
+        insert(value);
+    else
+        erase(value);
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+
+// Set of integers from [0, universe) with O(1) insert, erase and membership
+// and iteration over the members only. Iteration order is insertion order,
+// except that erasing moves the last member into the freed slot.
+class SparseSet {
+  private:
+    std::vector<int> members;
+    std::vector<int> positions; // Index into members, -1 if absent
+
+  public:
+    SparseSet() = default;
+    explicit SparseSet(size_t universe);
+
+    void resize(size_t universe); // Members outside the new range are dropped
+    void clear();
+
+    bool contains(int value) const { return positions[value] >= 0; }
+    void insert(int value);
+    void erase(int value);
+    // Inserts or erases value so that membership equals present
+    void assign(int value, bool present);
+
+    size_t size() const { return members.size(); }
+    bool empty() const { return members.empty(); }
+    const int* begin() const { return members.data(); }
+    const int* end() const { return members.data() + members.size(); }
+};
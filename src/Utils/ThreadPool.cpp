@@ -0,0 +1,92 @@
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+
+ThreadPool::ThreadPool(unsigned threads) {
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    workers.reserve(threads);
+    for (unsigned i = 0; i < threads; ++i)
+        workers.emplace_back(&ThreadPool::run, this);
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    available.notify_all();
+    for (std::thread &worker : workers)
+        worker.join();
+}
+
+void ThreadPool::enqueue(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        tasks.push_back(std::move(task));
+    }
+    available.notify_one();
+}
+
+void ThreadPool::run() {
+    for (;;) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            available.wait(lock, [this] { return stopping || !tasks.empty(); });
+            if (tasks.empty())
+                return; // Stopping and drained
+            task = std::move(tasks.front());
+            tasks.pop_front();
+        }
+        task();
+    }
+}
+
+// Helpers may start after every index has been claimed, even after this
+// call has returned, so the state they touch is shared and they only use
+// body once they have claimed an index
+void ThreadPool::parallelFor(size_t count,
+                             const std::function<void(size_t)> &body) {
+    if (count == 0)
+        return;
+
+    struct Progress {
+        std::atomic<size_t> next{0};
+        std::atomic<size_t> completed{0};
+        const std::function<void(size_t)>* body;
+        size_t count;
+        std::mutex mutex;
+        std::condition_variable done;
+
+        void work() {
+            size_t finished = 0;
+            for (size_t i; (i = next.fetch_add(1)) < count; ++finished)
+                (*body)(i);
+            if (finished != 0
+                && completed.fetch_add(finished) + finished == count) {
+                std::lock_guard<std::mutex> lock(mutex);
+                done.notify_all();
+            }
+        }
+    };
+    auto progress = std::make_shared<Progress>();
+    progress->body = &body;
+    progress->count = count;
+
+    size_t helpers = std::min<size_t>(workers.size(), count - 1);
+    for (size_t h = 0; h < helpers; ++h)
+        enqueue([progress]() { progress->work(); });
+    progress->work();
+
+    std::unique_lock<std::mutex> lock(progress->mutex);
+    progress->done.wait(lock, [&progress] {
+        return progress->completed.load() == progress->count;
+    });
+}
+
+ThreadPool &ThreadPool::shared() {
+    static ThreadPool pool;
+    return pool;
+}
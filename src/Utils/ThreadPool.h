@@ -0,0 +1,52 @@
+#pragma once
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Fixed set of worker threads running queued tasks in FIFO order
+class ThreadPool {
+  private:
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> tasks;
+    std::mutex mutex;
+    std::condition_variable available;
+    bool stopping = false;
+
+    void enqueue(std::function<void()> task);
+    void run();
+
+  public:
+    // threads == 0 uses every hardware thread
+    explicit ThreadPool(unsigned threads = 0);
+    ~ThreadPool(); // Finishes the queued tasks, then joins
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    unsigned size() const { return static_cast<unsigned>(workers.size()); }
+
+    // Queues task and returns a future for its result
+    template <typename F>
+    auto submit(F task) -> std::future<std::invoke_result_t<F>> {
+        using Result = std::invoke_result_t<F>;
+        auto packaged =
+            std::make_shared<std::packaged_task<Result()>>(std::move(task));
+        std::future<Result> result = packaged->get_future();
+        enqueue([packaged]() { (*packaged)(); });
+        return result;
+    }
+
+    // Calls body(i) for every i in [0, count) and returns once all calls
+    // are done. The calling thread takes indices too, so this makes
+    // progress even when called from a worker of a busy pool.
+    void parallelFor(size_t count, const std::function<void(size_t)> &body);
+
+    // Process-wide pool with one worker per hardware thread
+    static ThreadPool &shared();
+};
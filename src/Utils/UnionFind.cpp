@@ -0,0 +1,40 @@
+#include "UnionFind.h"
+#include <utility>
+
+UnionFind::UnionFind(int count) {
+    reset(count);
+}
+
+void UnionFind::reset(int count) {
+    parent.resize(count);
+    sizes.assign(count, 1);
+    for (int i = 0; i < count; ++i)
+        parent[i] = i;
+}
+
+int UnionFind::add() {
+    int id = static_cast<int>(parent.size());
+    parent.push_back(id);
+    sizes.push_back(1);
+    return id;
+}
+
+int UnionFind::find(int x) {
+    while (parent[x] != x) {
+        parent[x] = parent[parent[x]];
+        x = parent[x];
+    }
+    return x;
+}
+
+bool UnionFind::unite(int a, int b) {
+    a = find(a);
+    b = find(b);
+    if (a == b)
+        return false;
+    if (sizes[a] < sizes[b])
+        std::swap(a, b);
+    parent[b] = a;
+    sizes[a] += sizes[b];
+    return true;
+}
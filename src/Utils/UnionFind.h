@@ -0,0 +1,23 @@
+#pragma once
+#include <vector>
+
+// Disjoint-set forest over dense integer IDs (union by size, path halving)
+class UnionFind {
+  private:
+    std::vector<int> parent;
+    std::vector<int> sizes;
+
+  public:
+    UnionFind() = default;
+    explicit UnionFind(int count);
+
+    void reset(int count);
+    int add(); // Appends a singleton set and returns its ID
+    int size() const { return static_cast<int>(parent.size()); }
+
+    int find(int x);
+    // Merges the sets of a and b; returns false if they were already joined
+    bool unite(int a, int b);
+    bool connected(int a, int b) { return find(a) == find(b); }
+    int setSize(int x) { return sizes[find(x)]; }
+};
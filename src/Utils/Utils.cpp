@@ -21,4 +21,13 @@ std::vector<std::string> splitString(const std::string &str, char delimiter) {
         }
     }
     return tokens;
-}
\ No newline at end of file
+}
+
+uint64_t fnv1aHash(std::string_view data) {
+    uint64_t hash = 14695981039346656037ull;
+    for (unsigned char c : data) {
+        hash ^= c;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
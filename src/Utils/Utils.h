@@ -1,7 +1,9 @@
 #pragma once
 
+#include <cstdint>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 extern const std::string MAP_SECTION_HEADER;
@@ -9,4 +11,7 @@ extern const std::string CONTINENT_SECTION_HEADER;
 extern const std::string TERRITORY_SECTION_HEADER;
 extern const std::string SEPARATOR_LINE;
 
-std::vector<std::string> splitString(const std::string &str, char delimiter);
\ No newline at end of file
+std::vector<std::string> splitString(const std::string &str, char delimiter);
+
+// 64-bit FNV-1a hash of a byte range
+uint64_t fnv1aHash(std::string_view data);
@@ -0,0 +1,49 @@
+#include "MapGenerator.h"
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+// Usage: GenerateMap <output.map> [--territories N] [--continents K]
+//                    [--degree uniform|powerlaw|grid] [--avg-degree D]
+//                    [--seed S]
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cout << "Usage: " << argv[0]
+                  << " <output.map> [--territories N] [--continents K]"
+                     " [--degree uniform|powerlaw|grid] [--avg-degree D]"
+                     " [--seed S]"
+                  << std::endl;
+        return 1;
+    }
+
+    MapGeneratorOptions options;
+    for (int i = 2; i + 1 < argc; i += 2) {
+        std::string flag = argv[i];
+        std::string value = argv[i + 1];
+        if (flag == "--territories") {
+            options.territories = std::atoi(value.c_str());
+        } else if (flag == "--continents") {
+            options.continents = std::atoi(value.c_str());
+        } else if (flag == "--avg-degree") {
+            options.averageDegree = std::atof(value.c_str());
+        } else if (flag == "--seed") {
+            options.seed = static_cast<uint32_t>(std::stoul(value));
+        } else if (flag == "--degree") {
+            if (!parseDegreeDistribution(value, options.distribution)) {
+                std::cout << "Unknown degree distribution: " << value
+                          << std::endl;
+                return 1;
+            }
+        } else {
+            std::cout << "Unknown option: " << flag << std::endl;
+            return 1;
+        }
+    }
+
+    if (!writeGeneratedMap(argv[1], options))
+        return 1;
+    std::cout << "Wrote " << options.territories << " territories in "
+              << options.continents << " continents to " << argv[1]
+              << std::endl;
+    return 0;
+}
@@ -0,0 +1,353 @@
+#include "Map/MapLoader.h"
+#include "MapGenerator.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+// Usage: LoaderBenchmark [--res DIR] [--sizes 10000,100000] [--repeat N]
+//                        [--baseline FILE] [--write-baseline FILE]
+//                        [--tolerance 0.25] [--min-time 0.5]
+// Times MapLoader::loadMap and Map::validateWithReport on every .map file in
+// DIR (default res) and on generated maps of each size, and reports MB/s,
+// territories/s, peak RSS and heap allocations per territory. Loads bypass
+// the compiled-map cache so the parser is what gets measured. Each case
+// runs in its own child process where fork() is available, so its peak RSS
+// is its own rather than the largest case's so far, and repeats until it
+// has run for at least the minimum time (seconds) so small maps time
+// something measurable.
+// With --baseline, exits with status 1 if any case is slower, allocates
+// more or peaks higher than the stored numbers by more than the tolerance,
+// or if a baseline case failed to load or was not run.
+// Throughput depends on the machine, so write a baseline on the machine
+// that will check against it.
+
+// Every heap allocation in the process goes through these
+static std::atomic<size_t> allocationCount{0};
+
+void* operator new(std::size_t size) {
+    ++allocationCount;
+    if (void* p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+namespace {
+struct Result {
+    double mbPerSecond = 0.0;          // Source bytes parsed per second
+    double territoriesPerSecond = 0.0; // Through load and validation
+    double allocationsPerTerritory = 0.0;
+    long peakRssKb = 0;
+};
+
+double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now()
+                                         - start)
+        .count();
+}
+
+// Largest resident set of this process so far, 0 where unsupported
+long peakRssKb() {
+#ifndef _WIN32
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+        return usage.ru_maxrss; // Kilobytes on Linux
+#endif
+    return 0;
+}
+
+// Best of at least repeat runs, continuing until minSeconds have passed;
+// allocations are counted on the first
+bool measure(const std::string &path,
+             int repeat,
+             double minSeconds,
+             Result &result) {
+    double fileBytes = static_cast<double>(std::filesystem::file_size(path));
+    double bestLoad = 0.0;
+    double bestTotal = 0.0;
+    auto started = std::chrono::steady_clock::now();
+    for (int run = 0; run < repeat || secondsSince(started) < minSeconds;
+         ++run) {
+        size_t allocationsBefore = allocationCount.load();
+        auto start = std::chrono::steady_clock::now();
+        MapLoader loader(path);
+        loader.setVerbose(false);
+        loader.setUseCache(false);
+        Map* map = loader.loadMap();
+        double loadSeconds = secondsSince(start);
+        size_t allocations = allocationCount.load() - allocationsBefore;
+        if (!map)
+            return false;
+        map->validateWithReport();
+        double totalSeconds = secondsSince(start);
+
+        int territories = std::max(1, map->getTerritoryCount());
+        if (run == 0) {
+            result.allocationsPerTerritory =
+                static_cast<double>(allocations) / territories;
+        }
+        if (run == 0 || loadSeconds < bestLoad)
+            bestLoad = loadSeconds;
+        if (run == 0 || totalSeconds < bestTotal)
+            bestTotal = totalSeconds;
+        result.territoriesPerSecond =
+            territories / std::max(bestTotal, 1e-9);
+        delete map;
+    }
+    result.mbPerSecond = fileBytes / (1 << 20) / std::max(bestLoad, 1e-9);
+    result.peakRssKb = peakRssKb();
+    return true;
+}
+
+// measure() in a forked child, which reports back through a pipe
+bool measureInChild(const std::string &path,
+                    int repeat,
+                    double minSeconds,
+                    Result &result) {
+#ifndef _WIN32
+    int fds[2];
+    if (pipe(fds) == 0) {
+        std::cout.flush();
+        pid_t child = fork();
+        if (child == 0) {
+            close(fds[0]);
+            Result measured;
+            bool loaded = measure(path, repeat, minSeconds, measured);
+            if (loaded)
+                loaded = write(fds[1], &measured, sizeof(measured))
+                    == static_cast<ssize_t>(sizeof(measured));
+            _exit(loaded ? 0 : 1);
+        }
+        close(fds[1]);
+        bool received = child > 0
+            && read(fds[0], &result, sizeof(result))
+                   == static_cast<ssize_t>(sizeof(result));
+        close(fds[0]);
+        int status = 0;
+        if (child > 0)
+            waitpid(child, &status, 0);
+        return received && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    }
+#endif
+    return measure(path, repeat, minSeconds, result);
+}
+
+// One line per case: name mbPerSecond territoriesPerSecond
+// allocationsPerTerritory peakRssKb
+std::map<std::string, Result> readBaseline(const std::string &path) {
+    std::map<std::string, Result> baseline;
+    std::ifstream in(path);
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.empty() || line[0] == '#')
+            continue;
+        std::istringstream fields(line);
+        std::string name;
+        Result result;
+        if (fields >> name >> result.mbPerSecond >> result.territoriesPerSecond
+            >> result.allocationsPerTerritory >> result.peakRssKb)
+            baseline[name] = result;
+    }
+    return baseline;
+}
+
+bool writeBaseline(const std::string &path,
+                   const std::vector<std::pair<std::string, Result>> &results) {
+    std::ofstream out(path);
+    out << "# case MB/s territories/s allocations/territory peakRssKb\n";
+    for (const auto &[name, result] : results) {
+        out << name << " " << result.mbPerSecond << " "
+            << result.territoriesPerSecond << " "
+            << result.allocationsPerTerritory << " " << result.peakRssKb
+            << "\n";
+    }
+    return static_cast<bool>(out);
+}
+
+// Prints and counts every metric that is worse than the baseline allows
+int countRegressions(const std::string &name,
+                     const Result &current,
+                     const Result &baseline,
+                     double tolerance) {
+    int regressions = 0;
+    auto check = [&](const char* metric, double now, double then,
+                     bool higherIsBetter) {
+        bool worse = higherIsBetter ? now < then * (1.0 - tolerance)
+                                    : now > then * (1.0 + tolerance);
+        if (worse) {
+            std::cout << "REGRESSION: " << name << " " << metric << " " << now
+                      << " vs baseline " << then << std::endl;
+            ++regressions;
+        }
+    };
+    check("MB/s", current.mbPerSecond, baseline.mbPerSecond, true);
+    check("territories/s", current.territoriesPerSecond,
+          baseline.territoriesPerSecond, true);
+    // Half an allocation of slack so tiny maps don't trip on rounding
+    check("allocations/territory", current.allocationsPerTerritory,
+          baseline.allocationsPerTerritory + 0.5, false);
+    check("peak RSS", static_cast<double>(current.peakRssKb),
+          static_cast<double>(baseline.peakRssKb), false);
+    return regressions;
+}
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::string resDir = "res";
+    std::vector<int> sizes = {10000, 100000};
+    int repeat = 3;
+    std::string baselinePath;
+    std::string writeBaselinePath;
+    double tolerance = 0.25;
+    double minSeconds = 0.5;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string flag = argv[i];
+        std::string value = argv[i + 1];
+        if (flag == "--res") {
+            resDir = value;
+        } else if (flag == "--sizes") {
+            sizes.clear();
+            std::istringstream list(value);
+            std::string size;
+            while (std::getline(list, size, ','))
+                sizes.push_back(std::atoi(size.c_str()));
+        } else if (flag == "--repeat") {
+            repeat = std::max(1, std::atoi(value.c_str()));
+        } else if (flag == "--baseline") {
+            baselinePath = value;
+        } else if (flag == "--write-baseline") {
+            writeBaselinePath = value;
+        } else if (flag == "--tolerance") {
+            tolerance = std::atof(value.c_str());
+        } else if (flag == "--min-time") {
+            minSeconds = std::atof(value.c_str());
+        } else {
+            std::cout << "Unknown option: " << flag << std::endl;
+            return 1;
+        }
+    }
+
+    // Cases: the shipped maps in name order, then generated maps by size
+    std::vector<std::pair<std::string, std::string>> cases;
+    std::error_code error;
+    std::vector<std::filesystem::path> mapFiles;
+    for (const auto &entry :
+         std::filesystem::directory_iterator(resDir, error)) {
+        if (entry.path().extension() == ".map")
+            mapFiles.push_back(entry.path());
+    }
+    std::sort(mapFiles.begin(), mapFiles.end());
+    for (const auto &path : mapFiles)
+        cases.emplace_back(path.filename().string(), path.string());
+
+    std::vector<std::string> generated;
+    for (int size : sizes) {
+        MapGeneratorOptions options;
+        options.territories = size;
+        options.continents = std::max(1, size / 100);
+        std::string path = "LoaderBenchmark_" + std::to_string(size) + ".map";
+        if (!writeGeneratedMap(path, options))
+            return 1;
+        generated.push_back(path);
+        cases.emplace_back("generated-" + std::to_string(size), path);
+    }
+
+    std::cout << std::left << std::setw(28) << "Case" << std::setw(12)
+              << "MB/s" << std::setw(16) << "Territories/s" << std::setw(14)
+              << "Allocs/terr" << "Peak RSS (KB)" << std::endl;
+
+    std::vector<std::pair<std::string, Result>> results;
+    for (const auto &[name, path] : cases) {
+        Result result;
+        if (!measureInChild(path, repeat, minSeconds, result)) {
+            std::cout << std::setw(28) << name << "failed to load"
+                      << std::endl;
+            continue;
+        }
+        results.emplace_back(name, result);
+        std::cout << std::setw(28) << name << std::fixed
+                  << std::setprecision(1) << std::setw(12)
+                  << result.mbPerSecond << std::setw(16)
+                  << result.territoriesPerSecond << std::setw(14)
+                  << result.allocationsPerTerritory << result.peakRssKb
+                  << std::endl;
+    }
+
+    for (const std::string &path : generated)
+        std::remove(path.c_str());
+
+    if (!writeBaselinePath.empty()) {
+        if (!writeBaseline(writeBaselinePath, results)) {
+            std::cout << "Could not write baseline " << writeBaselinePath
+                      << std::endl;
+            return 1;
+        }
+        std::cout << "Baseline written to " << writeBaselinePath << std::endl;
+    }
+
+    if (!baselinePath.empty()) {
+        std::map<std::string, Result> baseline = readBaseline(baselinePath);
+        if (baseline.empty()) {
+            std::cout << "Could not read baseline " << baselinePath
+                      << std::endl;
+            return 1;
+        }
+        int regressions = 0;
+        for (const auto &[name, expected] : baseline) {
+            const Result* current = nullptr;
+            for (const auto &[resultName, result] : results) {
+                if (resultName == name)
+                    current = &result;
+            }
+            if (!current) {
+                std::cout << "REGRESSION: " << name
+                          << " failed to load or was not run" << std::endl;
+                ++regressions;
+                continue;
+            }
+            regressions +=
+                countRegressions(name, *current, expected, tolerance);
+        }
+        std::cout << regressions << " regression(s) against " << baselinePath
+                  << std::endl;
+        return regressions == 0 ? 0 : 1;
+    }
+    return 0;
+}
@@ -0,0 +1,136 @@
+#include "GameEngine/GameEngine.h"
+#include "LoggingObserver/LoggingObserver.h"
+#include "Map/CompiledMap.h"
+#include "Map/MapLoader.h"
+#include "MapGenerator.h"
+#include "Player/Player.h"
+#include "PlayerStrategies/PlayerStrategies.h"
+#include "Utils/Log.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <filesystem>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Usage: MapBenchmark [--sizes 1000,10000,100000] [--turns T] [--players P]
+//                     [--degree uniform|powerlaw|grid] [--avg-degree D]
+// For each size a map is generated to a temporary file, then loading,
+// validation and T turns of GameEngine::mainGameLoop (P players from 2 to 6,
+// aggressive and benevolent alternating) are timed. Game output is turned
+// off while timing.
+namespace {
+double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now()
+                                         - start)
+        .count();
+}
+
+// Times turns of the engine's own main loop on the map at path, after
+// starting a game with playerCount AI players (aggressive and benevolent
+// alternating)
+double timeTurns(const std::string &path, int playerCount, int turns) {
+    std::ostream discard(nullptr); // No gamelog.txt while timing
+    GameEngine engine(nullptr, new LogObserver(&discard));
+    engine.loadMap(std::filesystem::absolute(path).string());
+    engine.validateMap();
+    for (int p = 0; p < playerCount; ++p)
+        engine.addPlayer("P" + std::to_string(p));
+    for (size_t p = 0; p < engine.getPlayers().size(); ++p) {
+        Player* player = engine.getPlayers()[p];
+        delete player->getStrategy();
+        player->setStrategy(
+            p % 2 ? static_cast<PlayerStrategy*>(new BenevolentPlayerStrategy())
+                  : static_cast<PlayerStrategy*>(
+                        new AggressivePlayerStrategy()));
+    }
+    // Without a main loop, gameStart only deals the territories and armies
+    engine.gameStart(false);
+    if (engine.getPlayers().empty()
+        || engine.getPlayers().front()->getTerritories().empty())
+        return 0.0;
+
+    auto start = std::chrono::steady_clock::now();
+    engine.mainGameLoop(true, turns);
+    return secondsSince(start);
+}
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::vector<int> sizes = {1000, 10000, 100000};
+    int turns = 10;
+    int playerCount = 4;
+    MapGeneratorOptions options;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string flag = argv[i];
+        std::string value = argv[i + 1];
+        if (flag == "--sizes") {
+            sizes.clear();
+            std::istringstream list(value);
+            std::string size;
+            while (std::getline(list, size, ','))
+                sizes.push_back(std::atoi(size.c_str()));
+        } else if (flag == "--turns") {
+            turns = std::atoi(value.c_str());
+        } else if (flag == "--players") {
+            playerCount = std::clamp(std::atoi(value.c_str()), 2, 6);
+        } else if (flag == "--avg-degree") {
+            options.averageDegree = std::atof(value.c_str());
+        } else if (flag == "--degree") {
+            if (!parseDegreeDistribution(value, options.distribution)) {
+                std::cout << "Unknown degree distribution: " << value
+                          << std::endl;
+                return 1;
+            }
+        } else {
+            std::cout << "Unknown option: " << flag << std::endl;
+            return 1;
+        }
+    }
+
+    std::cout << std::left << std::setw(12) << "Territories" << std::setw(12)
+              << "Load (s)" << std::setw(14) << "Validate (s)" << std::setw(12)
+              << "Turns (s)" << "Valid" << std::endl;
+
+    for (int size : sizes) {
+        options.territories = size;
+        options.continents = std::max(1, size / 100);
+        std::string path = "MapBenchmark_" + std::to_string(size) + ".map";
+        if (!writeGeneratedMap(path, options))
+            return 1;
+
+        LogLevel consoleLevel = Log::getLevel();
+        Log::setLevel(LogLevel::Off);
+
+        auto start = std::chrono::steady_clock::now();
+        MapLoader loader(path);
+        loader.setVerbose(false);
+        loader.setUseCache(false); // Time the parser, not the cache
+        Map* map = loader.loadMap();
+        double loadSeconds = secondsSince(start);
+
+        start = std::chrono::steady_clock::now();
+        bool valid = map && map->validate();
+        double validateSeconds = secondsSince(start);
+
+        delete map;
+
+        // The engine loads the map through its registry, which writes the
+        // compiled cache next to it
+        double turnSeconds = valid ? timeTurns(path, playerCount, turns) : 0.0;
+
+        Log::setLevel(consoleLevel);
+        std::remove(path.c_str());
+        std::remove(CompiledMap::cachePathFor(path).c_str());
+        std::cout << std::left << std::setw(12) << size << std::setw(12)
+                  << loadSeconds << std::setw(14) << validateSeconds
+                  << std::setw(12) << turnSeconds << (valid ? "yes" : "no")
+                  << std::endl;
+    }
+    return 0;
+}
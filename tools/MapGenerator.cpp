@@ -0,0 +1,151 @@
+#include "MapGenerator.h"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+// Undirected edge set over dense IDs, rejecting self-loops and duplicates
+class EdgeSet {
+  private:
+    std::vector<std::vector<int>> adjacency;
+    std::unordered_set<uint64_t> keys;
+
+  public:
+    explicit EdgeSet(int territories) : adjacency(territories) {}
+
+    bool add(int a, int b) {
+        if (a == b)
+            return false;
+        uint64_t key = (uint64_t(std::min(a, b)) << 32) | uint32_t(std::max(a, b));
+        if (!keys.insert(key).second)
+            return false;
+        adjacency[a].push_back(b);
+        adjacency[b].push_back(a);
+        return true;
+    }
+
+    void reserve(size_t edges) { keys.reserve(edges); }
+    size_t edgeCount() const { return keys.size(); }
+    const std::vector<int> &neighbors(int id) const { return adjacency[id]; }
+};
+
+// Continents are contiguous ID ranges of near-equal size
+int continentStart(int continent, int territories, int continents) {
+    return static_cast<int>(int64_t(territories) * continent / continents);
+}
+} // namespace
+
+bool parseDegreeDistribution(const std::string &name,
+                             DegreeDistribution &distribution) {
+    if (name == "uniform")
+        distribution = DegreeDistribution::Uniform;
+    else if (name == "powerlaw")
+        distribution = DegreeDistribution::PowerLaw;
+    else if (name == "grid")
+        distribution = DegreeDistribution::Grid;
+    else
+        return false;
+    return true;
+}
+
+bool writeGeneratedMap(const std::string &path,
+                       const MapGeneratorOptions &options) {
+    int n = std::max(1, options.territories);
+    int k = std::max(1, std::min(options.continents, n));
+    int width = std::max(1, static_cast<int>(std::sqrt(double(n))));
+    std::mt19937 rng(options.seed);
+    EdgeSet edges(n);
+    edges.reserve(static_cast<size_t>(n * options.averageDegree / 2) + n);
+
+    // Endpoint list for preferential attachment: each edge adds both ends
+    std::vector<int> endpoints;
+    auto link = [&](int a, int b) {
+        if (edges.add(a, b)
+            && options.distribution == DegreeDistribution::PowerLaw) {
+            endpoints.push_back(a);
+            endpoints.push_back(b);
+        }
+    };
+
+    if (options.distribution == DegreeDistribution::Grid) {
+        // Row-major lattice. Consecutive IDs are always joined (row ends
+        // wrap to the next row), so every continent's ID range is connected.
+        for (int id = 0; id < n; ++id) {
+            if (id + 1 < n)
+                link(id, id + 1);
+            if (id + width < n)
+                link(id, id + width);
+        }
+    } else {
+        // Random spanning tree inside each continent, continents chained
+        for (int c = 0; c < k; ++c) {
+            int first = continentStart(c, n, k);
+            int last = continentStart(c + 1, n, k);
+            for (int id = first + 1; id < last; ++id) {
+                std::uniform_int_distribution<int> pick(first, id - 1);
+                link(id, pick(rng));
+            }
+            if (c > 0)
+                link(first, continentStart(c - 1, n, k));
+        }
+
+        // Top up to the requested average degree
+        size_t target = static_cast<size_t>(n * options.averageDegree / 2);
+        std::uniform_int_distribution<int> any(0, n - 1);
+        size_t attempts = 0;
+        while (edges.edgeCount() < target && attempts++ < target * 4) {
+            int a = any(rng);
+            int b;
+            if (options.distribution == DegreeDistribution::PowerLaw
+                && !endpoints.empty()) {
+                std::uniform_int_distribution<size_t> end(0,
+                                                          endpoints.size() - 1);
+                b = endpoints[end(rng)];
+            } else {
+                b = any(rng);
+            }
+            link(a, b);
+        }
+    }
+
+    std::ofstream out(path, std::ios::binary);
+    if (!out) {
+        std::cout << "Could not write map file: " << path << std::endl;
+        return false;
+    }
+
+    std::string buffer;
+    buffer.reserve(1 << 20);
+    auto flush = [&]() {
+        out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        buffer.clear();
+    };
+
+    buffer += "[Map]\nauthor=MapGenerator\nimage=none\nwrap=no\nscroll=none\n"
+              "warn=yes\n\n[Continents]\n";
+    for (int c = 0; c < k; ++c) {
+        int size = continentStart(c + 1, n, k) - continentStart(c, n, k);
+        buffer += "C" + std::to_string(c) + "="
+            + std::to_string(std::max(1, size / 10)) + "\n";
+    }
+
+    buffer += "\n[Territories]\n";
+    int continent = 0;
+    for (int id = 0; id < n; ++id) {
+        while (id >= continentStart(continent + 1, n, k))
+            ++continent;
+        buffer += "T" + std::to_string(id) + "," + std::to_string(id % width)
+            + "," + std::to_string(id / width) + ",C" + std::to_string(continent);
+        for (int neighbor : edges.neighbors(id))
+            buffer += ",T" + std::to_string(neighbor);
+        buffer += '\n';
+        if (buffer.size() > (1 << 20))
+            flush();
+    }
+    flush();
+    return static_cast<bool>(out);
+}
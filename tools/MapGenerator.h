@@ -0,0 +1,27 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+// How extra edges are added on top of each continent's spanning tree
+enum class DegreeDistribution {
+    Uniform,  // Endpoints drawn uniformly at random
+    PowerLaw, // Preferential attachment: well-connected territories attract
+    Grid      // Lattice neighbours only, no random edges
+};
+
+struct MapGeneratorOptions {
+    int territories = 1000;
+    int continents = 10;
+    double averageDegree = 4.0;
+    DegreeDistribution distribution = DegreeDistribution::Uniform;
+    uint32_t seed = 1;
+};
+
+// Writes a valid .map file in the [Map]/[Continents]/[Territories] format:
+// the graph is connected, every continent is a connected subgraph and every
+// territory belongs to exactly one continent. Returns false on I/O failure.
+bool writeGeneratedMap(const std::string &path,
+                       const MapGeneratorOptions &options);
+
+bool parseDegreeDistribution(const std::string &name,
+                             DegreeDistribution &distribution);